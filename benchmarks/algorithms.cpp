@@ -0,0 +1,377 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_algorithms_cpp {
+
+template <std::size_t I>
+struct DDim
+{
+};
+
+template <std::size_t>
+using index_type = std::int64_t;
+
+template <class ExecSpace, std::size_t Rank>
+auto kokkos_policy(
+        ExecSpace const& exec_space,
+        Kokkos::Array<std::int64_t, Rank> const& begin,
+        Kokkos::Array<std::int64_t, Rank> const& end)
+{
+    if constexpr (Rank == 1) {
+        return Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::int64_t>>(
+                exec_space,
+                begin[0],
+                end[0]);
+    } else {
+        return Kokkos::
+                MDRangePolicy<ExecSpace, Kokkos::Rank<Rank>, Kokkos::IndexType<std::int64_t>>(
+                        exec_space,
+                        begin,
+                        end);
+    }
+}
+
+// Hand-written Kokkos functors, the reference of the DDC algorithms
+
+template <class View, class ConstView, class Seq>
+struct KokkosTriad;
+
+template <class View, class ConstView, std::size_t... Is>
+struct KokkosTriad<View, ConstView, std::index_sequence<Is...>>
+{
+    View a;
+
+    ConstView b;
+
+    ConstView c;
+
+    double s;
+
+    KOKKOS_FUNCTION void operator()(index_type<Is> const... i) const
+    {
+        a(i...) = b(i...) + s * c(i...);
+    }
+};
+
+template <class View, class ConstView, class Seq>
+struct KokkosStencil;
+
+/// Second order finite difference along the first dimension
+template <class View, class ConstView, std::size_t I0, std::size_t... Is>
+struct KokkosStencil<View, ConstView, std::index_sequence<I0, Is...>>
+{
+    View out;
+
+    ConstView in;
+
+    KOKKOS_FUNCTION void operator()(index_type<I0> const i0, index_type<Is> const... i) const
+    {
+        out(i0, i...) = in(i0 - 1, i...) - 2. * in(i0, i...) + in(i0 + 1, i...);
+    }
+};
+
+template <class ConstView, class Seq>
+struct KokkosSum;
+
+template <class ConstView, std::size_t... Is>
+struct KokkosSum<ConstView, std::index_sequence<Is...>>
+{
+    ConstView b;
+
+    KOKKOS_FUNCTION void operator()(index_type<Is> const... i, double& sum) const
+    {
+        sum += b(i...);
+    }
+};
+
+// DDC equivalents
+
+template <class ExecSpace, class ChunkSpanType, class ChunkSpanConstType>
+void ddc_triad(
+        ExecSpace const& exec_space,
+        ChunkSpanType const& a,
+        ChunkSpanConstType const& b,
+        ChunkSpanConstType const& c,
+        double const s)
+{
+    ddc::parallel_for_each(
+            exec_space,
+            a.domain(),
+            KOKKOS_LAMBDA(typename ChunkSpanType::discrete_element_type const i) {
+                a(i) = b(i) + s * c(i);
+            });
+}
+
+/// Same finite difference as `KokkosStencil`, `interior` excludes the boundaries along DDim<0>
+template <class ExecSpace, class ChunkSpanType, class ChunkSpanConstType, class DDom>
+void ddc_stencil(
+        ExecSpace const& exec_space,
+        ChunkSpanType const& out,
+        ChunkSpanConstType const& in,
+        DDom const& interior)
+{
+    ddc::parallel_for_each(
+            exec_space,
+            interior,
+            KOKKOS_LAMBDA(typename DDom::discrete_element_type const i) {
+                ddc::DiscreteVector<DDim<0>> const one(1);
+                out(i) = in(i - one) - 2. * in(i) + in(i + one);
+            });
+}
+
+template <class ExecSpace, class ChunkSpanConstType>
+double ddc_sum(ExecSpace const& exec_space, ChunkSpanConstType const& b)
+{
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            b.domain(),
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(typename ChunkSpanConstType::discrete_element_type const i) {
+                return b(i);
+            });
+}
+
+/**
+ * Time alternately the raw Kokkos and the DDC versions of a kernel.
+ *
+ * The reported time is the DDC one, the "overhead" counter is the relative extra time of DDC
+ * over the raw Kokkos kernel accumulated over all the iterations.
+ */
+template <class ExecSpace, class KokkosKernel, class DdcKernel>
+void compare(
+        benchmark::State& state,
+        ExecSpace const& exec_space,
+        KokkosKernel const& kokkos_kernel,
+        DdcKernel const& ddc_kernel,
+        std::size_t const bytes)
+{
+    double kokkos_seconds = 0;
+    double ddc_seconds = 0;
+    for (auto _ : state) {
+        Kokkos::Timer timer;
+        kokkos_kernel();
+        exec_space.fence();
+        kokkos_seconds += timer.seconds();
+        timer.reset();
+        ddc_kernel();
+        exec_space.fence();
+        double const seconds = timer.seconds();
+        ddc_seconds += seconds;
+        state.SetIterationTime(seconds);
+    }
+    state.counters["kokkos_time"] = benchmark::Counter(
+            kokkos_seconds,
+            benchmark::Counter::kAvgIterations);
+    state.counters["overhead"] = benchmark::Counter(ddc_seconds / kokkos_seconds - 1.);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(bytes));
+}
+
+/// Domain of about `state.range(0)` points with the same extent along each of the dimensions
+template <std::size_t... Is>
+ddc::DiscreteDomain<DDim<Is>...> make_domain(benchmark::State const& state)
+{
+    auto const n = std::int64_t(std::lround(
+            std::pow(double(state.range(0)), 1. / double(sizeof...(Is)))));
+    return ddc::DiscreteDomain<DDim<Is>...>(
+            ddc::DiscreteElement<DDim<Is>...>(
+                    ddc::create_reference_discrete_element<DDim<Is>>()...),
+            ddc::DiscreteVector<DDim<Is>...>(ddc::DiscreteVector<DDim<Is>>(n)...));
+}
+
+template <class DDom>
+Kokkos::Array<std::int64_t, DDom::rank()> extents_array(DDom const& ddom)
+{
+    Kokkos::Array<std::int64_t, DDom::rank()> extents;
+    for (std::size_t i = 0; i < DDom::rank(); ++i) {
+        extents[i] = ddc::detail::array(ddom.extents())[i];
+    }
+    return extents;
+}
+
+template <class ExecSpace, std::size_t... Is>
+void triad_impl(benchmark::State& state, std::index_sequence<Is...>)
+{
+    using MemorySpace = typename ExecSpace::memory_space;
+    ExecSpace const exec_space;
+    ddc::DiscreteDomain<DDim<Is>...> const ddom = make_domain<Is...>(state);
+    ddc::Chunk a_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::Chunk b_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::Chunk c_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const a = a_alloc.span_view();
+    ddc::ChunkSpan const b = b_alloc.span_cview();
+    ddc::ChunkSpan const c = c_alloc.span_cview();
+    ddc::parallel_fill(exec_space, b_alloc.span_view(), 1.);
+    ddc::parallel_fill(exec_space, c_alloc.span_view(), 2.);
+    double const s = 3.;
+
+    KokkosTriad<
+            decltype(a.allocation_kokkos_view()),
+            decltype(b.allocation_kokkos_view()),
+            std::index_sequence<Is...>> const
+            functor {a.allocation_kokkos_view(),
+                     b.allocation_kokkos_view(),
+                     c.allocation_kokkos_view(),
+                     s};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> const begin {};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> const end = extents_array(ddom);
+    exec_space.fence();
+    compare(
+            state,
+            exec_space,
+            [&] {
+                Kokkos::parallel_for(
+                        "kokkos_triad",
+                        kokkos_policy(exec_space, begin, end),
+                        functor);
+            },
+            [&] { ddc_triad(exec_space, a, b, c, s); },
+            3 * ddom.size() * sizeof(double));
+}
+
+template <class ExecSpace, std::size_t... Is>
+void stencil_impl(benchmark::State& state, std::index_sequence<Is...>)
+{
+    using MemorySpace = typename ExecSpace::memory_space;
+    ExecSpace const exec_space;
+    ddc::DiscreteDomain<DDim<Is>...> const ddom = make_domain<Is...>(state);
+    ddc::DiscreteVector<DDim<Is>...> const margin((Is == 0 ? 1 : 0)...);
+    ddc::DiscreteDomain<DDim<Is>...> const interior = ddom.remove(margin, margin);
+    ddc::Chunk out_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::Chunk in_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const out = out_alloc.span_view();
+    ddc::ChunkSpan const in = in_alloc.span_cview();
+    ddc::parallel_fill(exec_space, in_alloc.span_view(), 1.);
+
+    KokkosStencil<
+            decltype(out.allocation_kokkos_view()),
+            decltype(in.allocation_kokkos_view()),
+            std::index_sequence<Is...>> const
+            functor {out.allocation_kokkos_view(), in.allocation_kokkos_view()};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> begin {};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> end = extents_array(ddom);
+    begin[0] = 1;
+    end[0] -= 1;
+    exec_space.fence();
+    compare(
+            state,
+            exec_space,
+            [&] {
+                Kokkos::parallel_for(
+                        "kokkos_stencil",
+                        kokkos_policy(exec_space, begin, end),
+                        functor);
+            },
+            [&] { ddc_stencil(exec_space, out, in, interior); },
+            2 * interior.size() * sizeof(double));
+}
+
+template <class ExecSpace, std::size_t... Is>
+void reduction_impl(benchmark::State& state, std::index_sequence<Is...>)
+{
+    using MemorySpace = typename ExecSpace::memory_space;
+    ExecSpace const exec_space;
+    ddc::DiscreteDomain<DDim<Is>...> const ddom = make_domain<Is...>(state);
+    ddc::Chunk b_alloc(ddom, ddc::KokkosAllocator<double, MemorySpace>());
+    ddc::ChunkSpan const b = b_alloc.span_cview();
+    ddc::parallel_fill(exec_space, b_alloc.span_view(), 1.);
+
+    KokkosSum<decltype(b.allocation_kokkos_view()), std::index_sequence<Is...>> const functor {
+            b.allocation_kokkos_view()};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> const begin {};
+    Kokkos::Array<std::int64_t, sizeof...(Is)> const end = extents_array(ddom);
+    exec_space.fence();
+    double kokkos_sum = 0;
+    double ddc_sum_value = 0;
+    compare(
+            state,
+            exec_space,
+            [&] {
+                Kokkos::parallel_reduce(
+                        "kokkos_sum",
+                        kokkos_policy(exec_space, begin, end),
+                        functor,
+                        kokkos_sum);
+            },
+            [&] { ddc_sum_value = ddc_sum(exec_space, b); },
+            ddom.size() * sizeof(double));
+    benchmark::DoNotOptimize(kokkos_sum);
+    benchmark::DoNotOptimize(ddc_sum_value);
+}
+
+template <class ExecSpace, std::size_t Rank>
+void triad(benchmark::State& state)
+{
+    triad_impl<ExecSpace>(state, std::make_index_sequence<Rank>());
+}
+
+template <class ExecSpace, std::size_t Rank>
+void stencil(benchmark::State& state)
+{
+    stencil_impl<ExecSpace>(state, std::make_index_sequence<Rank>());
+}
+
+template <class ExecSpace, std::size_t Rank>
+void reduction(benchmark::State& state)
+{
+    reduction_impl<ExecSpace>(state, std::make_index_sequence<Rank>());
+}
+
+// A launch-bound and a bandwidth-bound number of points
+void sizes(benchmark::internal::Benchmark* const benchmark)
+{
+    benchmark->Arg(1 << 12)->Arg(1 << 24)->UseManualTime();
+}
+
+} // namespace anonymous_namespace_workaround_algorithms_cpp
+
+// NOLINTBEGIN(misc-use-anonymous-namespace)
+#define DDC_BENCHMARK_ALGORITHMS(ExecSpace)                                                        \
+    BENCHMARK_TEMPLATE(triad, ExecSpace, 1)->Apply(sizes);                                         \
+    BENCHMARK_TEMPLATE(triad, ExecSpace, 2)->Apply(sizes);                                         \
+    BENCHMARK_TEMPLATE(triad, ExecSpace, 3)->Apply(sizes);                                         \
+    BENCHMARK_TEMPLATE(triad, ExecSpace, 4)->Apply(sizes);                                         \
+    BENCHMARK_TEMPLATE(stencil, ExecSpace, 1)->Apply(sizes);                                       \
+    BENCHMARK_TEMPLATE(stencil, ExecSpace, 2)->Apply(sizes);                                       \
+    BENCHMARK_TEMPLATE(stencil, ExecSpace, 3)->Apply(sizes);                                       \
+    BENCHMARK_TEMPLATE(stencil, ExecSpace, 4)->Apply(sizes);                                       \
+    BENCHMARK_TEMPLATE(reduction, ExecSpace, 1)->Apply(sizes);                                     \
+    BENCHMARK_TEMPLATE(reduction, ExecSpace, 2)->Apply(sizes);                                     \
+    BENCHMARK_TEMPLATE(reduction, ExecSpace, 3)->Apply(sizes);                                     \
+    BENCHMARK_TEMPLATE(reduction, ExecSpace, 4)->Apply(sizes)
+
+DDC_BENCHMARK_ALGORITHMS(Kokkos::DefaultHostExecutionSpace);
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || defined(KOKKOS_ENABLE_SYCL)
+DDC_BENCHMARK_ALGORITHMS(Kokkos::DefaultExecutionSpace);
+#endif
+// NOLINTEND(misc-use-anonymous-namespace)
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::AddCustomContext(
+            "overhead",
+            "relative extra time of the DDC algorithm over the equivalent raw Kokkos kernel");
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    {
+        Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+        ddc::ScopeGuard const ddc_scope(argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+    }
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,286 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_discrete_space_cpp {
+
+struct X
+{
+    static constexpr bool PERIODIC = false;
+};
+
+struct DDimUniform : ddc::UniformPointSampling<X>
+{
+};
+
+struct DDimNonUniform : ddc::NonUniformPointSampling<X>
+{
+};
+
+struct DDimPeriodic : ddc::PeriodicSampling<X>
+{
+};
+
+/// Same mesh as `DDimUniform` for 2^10 points, the step being a compile-time constant
+struct DDimStaticUniform : ddc::StaticUniformPointSampling<X, std::ratio<0>, std::ratio<1, 1023>>
+{
+};
+
+std::size_t constexpr s_degree = 3;
+
+struct BSplinesUniform : ddc::UniformBSplines<X, s_degree>
+{
+};
+
+struct BSplinesNonUniform : ddc::NonUniformBSplines<X, s_degree>
+{
+};
+
+/// Indices of the evaluation points of the B-splines
+struct DDimEval
+{
+};
+
+/// Points of [0, 1] refined towards 0, so that the non-uniform cells are of varying width
+std::vector<ddc::Coordinate<X>> stretched_points(std::size_t const n)
+{
+    std::vector<ddc::Coordinate<X>> points(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double const x = double(i) / double(n - 1);
+        points[i] = ddc::Coordinate<X>(x * x);
+    }
+    return points;
+}
+
+template <class DDim>
+ddc::DiscreteDomain<DDim> init_sampling(std::size_t const n)
+{
+    if constexpr (std::is_same_v<DDim, DDimUniform>) {
+        return ddc::init_discrete_space<DDim>(DDim::template init<DDim>(
+                ddc::Coordinate<X>(0.),
+                ddc::Coordinate<X>(1.),
+                ddc::DiscreteVector<DDim>(n)));
+    } else if constexpr (std::is_same_v<DDim, DDimNonUniform>) {
+        return ddc::init_discrete_space<DDim>(DDim::template init<DDim>(stretched_points(n)));
+    } else if constexpr (std::is_same_v<DDim, DDimStaticUniform>) {
+        return ddc::init_discrete_space<DDim>(
+                DDim::template init<DDim>(ddc::DiscreteVector<DDim>(n)));
+    } else {
+        return ddc::init_discrete_space<DDim>(DDim::template init<DDim>(
+                ddc::Coordinate<X>(0.),
+                ddc::Coordinate<X>(1.),
+                ddc::DiscreteVector<DDim>(n),
+                ddc::DiscreteVector<DDim>(n)));
+    }
+}
+
+template <class BSplines>
+void init_bsplines(std::size_t const n_cells)
+{
+    if constexpr (BSplines::is_uniform()) {
+        ddc::init_discrete_space<BSplines>(ddc::Coordinate<X>(0.), ddc::Coordinate<X>(1.), n_cells);
+    } else {
+        ddc::init_discrete_space<BSplines>(stretched_points(n_cells + 1));
+    }
+}
+
+struct CoordinateLookup
+{
+    template <class DDim>
+    KOKKOS_FUNCTION static double apply(ddc::DiscreteElement<DDim> const& i)
+    {
+        return double(ddc::coordinate(i));
+    }
+};
+
+struct DistanceAtLeftLookup
+{
+    template <class DDim>
+    KOKKOS_FUNCTION static double apply(ddc::DiscreteElement<DDim> const& i)
+    {
+        return double(ddc::distance_at_left(i));
+    }
+};
+
+struct DistanceAtRightLookup
+{
+    template <class DDim>
+    KOKKOS_FUNCTION static double apply(ddc::DiscreteElement<DDim> const& i)
+    {
+        return double(ddc::distance_at_right(i));
+    }
+};
+
+template <class Lookup, class ExecSpace, class DDim>
+double sum_lookups(ExecSpace const& exec_space, ddc::DiscreteDomain<DDim> const& ddom)
+{
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            ddom,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDim> const i) { return Lookup::apply(i); });
+}
+
+template <class BSplines, class ExecSpace>
+double sum_basis(ExecSpace const& exec_space, ddc::DiscreteDomain<DDimEval> const& points)
+{
+    ddc::DiscreteElement<DDimEval> const first = points.front();
+    double const dx = 1. / double(points.size());
+    return ddc::parallel_transform_reduce(
+            exec_space,
+            points,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimEval> const i) {
+                ddc::Coordinate<X> const x((double((i - first).value()) + 0.5) * dx);
+                std::array<double, BSplines::degree() + 1> vals_ptr;
+                Kokkos::mdspan<double, Kokkos::extents<std::size_t, BSplines::degree() + 1>> const
+                        vals(vals_ptr.data());
+                ddc::DiscreteElement<BSplines> const jmin
+                        = ddc::discrete_space<BSplines>().eval_basis(vals, x);
+                double sum = double(jmin.uid());
+                for (std::size_t j = 0; j < vals.extent(0); ++j) {
+                    sum += vals[j];
+                }
+                return sum;
+            });
+}
+
+/**
+ * `Lookup` of every point of a `DDim` mesh of `state.range(0)` points but the first and the last
+ * ones, summed by a `parallel_transform_reduce` on `ExecSpace`.
+ */
+template <class ExecSpace, class DDim, class Lookup>
+void lookup(benchmark::State& state)
+{
+    ExecSpace const exec_space;
+    ddc::DiscreteDomain<DDim> const ddom = init_sampling<DDim>(state.range(0));
+    ddc::DiscreteDomain<DDim> const interior
+            = ddom.remove(ddc::DiscreteVector<DDim>(1), ddc::DiscreteVector<DDim>(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_lookups<Lookup>(exec_space, interior));
+    }
+    state.counters["lookups/s"] = benchmark::Counter(
+            double(state.iterations()) * double(interior.size()),
+            benchmark::Counter::kIsRate);
+
+    ////////////////////////////////////////////////////
+    /// --------------- HUGE WARNING --------------- ///
+    /// The following lines are forbidden in a prod- ///
+    /// uction code. It is a necessary workaround    ///
+    /// which must be used ONLY for Google Benchmark.///
+    /// The reason is it acts on underlying global   ///
+    /// variables, which is always a bad idea.       ///
+    ////////////////////////////////////////////////////
+    ddc::detail::g_discrete_space_dual<DDim>.reset();
+    ////////////////////////////////////////////////////
+}
+
+/**
+ * `eval_basis` of B-splines of `state.range(0)` cells at `state.range(1)` points, the search of
+ * the cell containing the point being included in the measure.
+ */
+template <class ExecSpace, class BSplines>
+void eval_basis(benchmark::State& state)
+{
+    ExecSpace const exec_space;
+    init_bsplines<BSplines>(state.range(0));
+    ddc::DiscreteDomain<DDimEval> const points(
+            ddc::create_reference_discrete_element<DDimEval>(),
+            ddc::DiscreteVector<DDimEval>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_basis<BSplines>(exec_space, points));
+    }
+    state.counters["evaluations/s"] = benchmark::Counter(
+            double(state.iterations()) * double(points.size()),
+            benchmark::Counter::kIsRate);
+
+    ////////////////////////////////////////////////////
+    /// --------------- HUGE WARNING --------------- ///
+    /// The following lines are forbidden in a prod- ///
+    /// uction code. It is a necessary workaround    ///
+    /// which must be used ONLY for Google Benchmark.///
+    /// The reason is it acts on underlying global   ///
+    /// variables, which is always a bad idea.       ///
+    ////////////////////////////////////////////////////
+    ddc::detail::g_discrete_space_dual<BSplines>.reset();
+    if constexpr (BSplines::is_uniform()) {
+        ddc::detail::g_discrete_space_dual<ddc::UniformBsplinesKnots<BSplines>>.reset();
+    } else {
+        ddc::detail::g_discrete_space_dual<ddc::NonUniformBsplinesKnots<BSplines>>.reset();
+    }
+    ////////////////////////////////////////////////////
+}
+
+// From a mesh that fits in the caches to one that does not
+void mesh_sizes(benchmark::internal::Benchmark* const benchmark)
+{
+    benchmark->RangeMultiplier(64)->Range(1 << 10, 1 << 22)->UseRealTime();
+}
+
+// Number of cells, the number of evaluation points is fixed
+void bsplines_sizes(benchmark::internal::Benchmark* const benchmark)
+{
+    benchmark->ArgsProduct({{1 << 4, 1 << 10, 1 << 16}, {1 << 20}})->UseRealTime();
+}
+
+} // namespace anonymous_namespace_workaround_discrete_space_cpp
+
+// NOLINTBEGIN(misc-use-anonymous-namespace)
+#define DDC_BENCHMARK_DISCRETE_SPACE(ExecSpace)                                                    \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimUniform, CoordinateLookup)->Apply(mesh_sizes);       \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimNonUniform, CoordinateLookup)->Apply(mesh_sizes);    \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimPeriodic, CoordinateLookup)->Apply(mesh_sizes);      \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimStaticUniform, CoordinateLookup)                     \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimUniform, DistanceAtLeftLookup)->Apply(mesh_sizes);   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimNonUniform, DistanceAtLeftLookup)                    \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimPeriodic, DistanceAtLeftLookup)->Apply(mesh_sizes);  \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimStaticUniform, DistanceAtLeftLookup)                 \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimUniform, DistanceAtRightLookup)->Apply(mesh_sizes);  \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimNonUniform, DistanceAtRightLookup)                   \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimPeriodic, DistanceAtRightLookup)                     \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(lookup, ExecSpace, DDimStaticUniform, DistanceAtRightLookup)                \
+            ->Apply(mesh_sizes);                                                                   \
+    BENCHMARK_TEMPLATE(eval_basis, ExecSpace, BSplinesUniform)->Apply(bsplines_sizes);             \
+    BENCHMARK_TEMPLATE(eval_basis, ExecSpace, BSplinesNonUniform)->Apply(bsplines_sizes)
+
+DDC_BENCHMARK_DISCRETE_SPACE(Kokkos::DefaultHostExecutionSpace);
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || defined(KOKKOS_ENABLE_SYCL)
+DDC_BENCHMARK_DISCRETE_SPACE(Kokkos::DefaultExecutionSpace);
+#endif
+// NOLINTEND(misc-use-anonymous-namespace)
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    {
+        Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+        ddc::ScopeGuard const ddc_scope(argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+    }
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,255 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+// The host backends of kokkos-fft rely on FFTW
+#if defined(KOKKOSFFT_ENABLE_SERIAL)                                                               \
+        || (defined(KOKKOS_ENABLE_SERIAL) && defined(KOKKOSFFT_ENABLE_TPL_FFTW))
+#    define DDC_BENCHMARK_FFT_SERIAL
+#endif
+
+#if defined(KOKKOSFFT_ENABLE_OPENMP)                                                               \
+        || (defined(KOKKOS_ENABLE_OPENMP) && defined(KOKKOSFFT_ENABLE_TPL_FFTW))
+#    define DDC_BENCHMARK_FFT_OPENMP
+#endif
+
+inline namespace anonymous_namespace_workaround_fft_cpp {
+
+struct X;
+struct Y;
+struct Z;
+
+template <typename CDim>
+struct DDim : ddc::UniformPointSampling<CDim>
+{
+};
+
+template <typename CDim>
+struct DFDim : ddc::PeriodicSampling<ddc::Fourier<CDim>>
+{
+};
+
+struct DDimBatch
+{
+};
+
+template <typename CDim>
+ddc::DiscreteDomain<DDim<CDim>> init_mesh(std::size_t const n)
+{
+    ddc::DiscreteDomain<DDim<CDim>> const x_mesh(
+            ddc::init_discrete_space<DDim<CDim>>(DDim<CDim>::template init<DDim<CDim>>(
+                    ddc::Coordinate<CDim>(-1.),
+                    ddc::Coordinate<CDim>(1.),
+                    ddc::DiscreteVector<DDim<CDim>>(n))));
+    ddc::init_discrete_space<DFDim<CDim>>(ddc::init_fourier_space<DFDim<CDim>>(x_mesh));
+    return x_mesh;
+}
+
+/**
+ * FFT of a batch of `state.range(1)` discrete functions defined on a mesh of `state.range(0)`
+ * points along each of the CDims dimensions, from the mesh to the Fourier mesh for the FORWARD
+ * direction and back for the BACKWARD one.
+ *
+ * - `state.range(2)` is the ddc::FFT_Normalization,
+ * - `state.range(3)` selects a prebuilt ddc::FFTPlan (1) or a call to ddc::fft or ddc::ifft (0),
+ *   the latter including the planning in the measure.
+ *
+ * `Tin` is the type of the elements on the mesh, a real type giving a R2C or C2R transform. The
+ * batch dimension is the outermost one. The GFLOP/s use the usual 5*N*log2(N) estimate for a C2C
+ * transform of N points and half of it for a R2C or C2R transform.
+ */
+template <ddc::FFT_Direction Direction, typename ExecSpace, typename Tin, typename... CDims>
+void fft_transform(benchmark::State& state)
+{
+    using Tout = Kokkos::complex<ddc::detail::fft::real_type_t<Tin>>;
+    using MemorySpace = typename ExecSpace::memory_space;
+    using DDomX = ddc::DiscreteDomain<DDimBatch, DDim<CDims>...>;
+    using DDomFx = ddc::DiscreteDomain<DDimBatch, DFDim<CDims>...>;
+    bool const c2c = ddc::detail::fft::is_complex_v<Tin>;
+    std::size_t const n = state.range(0);
+    std::size_t const n_batch = state.range(1);
+    ddc::FFT_Normalization const normalization
+            = static_cast<ddc::FFT_Normalization>(state.range(2));
+    bool const reuse_plan = state.range(3) != 0;
+    ExecSpace const exec_space;
+
+    DDomX const x_mesh(
+            ddc::DiscreteDomain<DDimBatch>(
+                    ddc::DiscreteElement<DDimBatch>(0),
+                    ddc::DiscreteVector<DDimBatch>(n_batch)),
+            init_mesh<CDims>(n)...);
+    DDomFx const k_mesh = ddc::fourier_mesh<DDimBatch, DFDim<CDims>...>(x_mesh, c2c);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::parallel_fill(exec_space, f, Tin(1));
+    ddc::Chunk Ff_alloc(k_mesh, ddc::KokkosAllocator<Tout, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::parallel_fill(exec_space, Ff, Tout(1));
+    exec_space.fence();
+
+    if constexpr (Direction == ddc::FFT_Direction::FORWARD) {
+        if (reuse_plan) {
+            ddc::FFTPlan<ExecSpace, Tin, Tout, DDomX, DDomFx, MemorySpace> const
+                    plan(exec_space, Ff, f, Direction, {normalization});
+            for (auto _ : state) {
+                plan(Ff, f);
+                exec_space.fence();
+            }
+        } else {
+            for (auto _ : state) {
+                ddc::fft(exec_space, Ff, f, {normalization});
+                exec_space.fence();
+            }
+        }
+    } else {
+        if (reuse_plan) {
+            ddc::FFTPlan<ExecSpace, Tout, Tin, DDomFx, DDomX, MemorySpace> const
+                    plan(exec_space, f, Ff, Direction, {normalization});
+            for (auto _ : state) {
+                plan(f, Ff);
+                exec_space.fence();
+            }
+        } else {
+            for (auto _ : state) {
+                ddc::ifft(exec_space, f, Ff, {normalization});
+                exec_space.fence();
+            }
+        }
+    }
+
+    double const n_transform = std::pow(double(n), double(sizeof...(CDims)));
+    double const flops = (c2c ? 5. : 2.5) * n_transform * std::log2(n_transform) * n_batch;
+    state.counters["GFLOP/s"] = benchmark::
+            Counter(flops * state.iterations() * 1e-9, benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(
+            int64_t(state.iterations())
+            * int64_t(x_mesh.size() * sizeof(Tin) + k_mesh.size() * sizeof(Tout)));
+
+    ////////////////////////////////////////////////////
+    /// --------------- HUGE WARNING --------------- ///
+    /// The following lines are forbidden in a prod- ///
+    /// uction code. It is a necessary workaround    ///
+    /// which must be used ONLY for Google Benchmark.///
+    /// The reason is it acts on underlying global   ///
+    /// variables, which is always a bad idea.       ///
+    ////////////////////////////////////////////////////
+    (ddc::detail::g_discrete_space_dual<DDim<CDims>>.reset(), ...);
+    (ddc::detail::g_discrete_space_dual<DFDim<CDims>>.reset(), ...);
+    ////////////////////////////////////////////////////
+}
+
+std::vector<int64_t> const normalizations
+        = {static_cast<int64_t>(ddc::FFT_Normalization::OFF),
+           static_cast<int64_t>(ddc::FFT_Normalization::FORWARD),
+           static_cast<int64_t>(ddc::FFT_Normalization::BACKWARD),
+           static_cast<int64_t>(ddc::FFT_Normalization::ORTHO),
+           static_cast<int64_t>(ddc::FFT_Normalization::FULL)};
+
+std::vector<int64_t> const plan_reuse = {0, 1};
+
+/// Register the (size along each transformed dimension, batch size) shapes
+void register_shapes(
+        benchmark::internal::Benchmark* const benchmark,
+        std::vector<std::array<int64_t, 2>> const& shapes)
+{
+    for (std::array<int64_t, 2> const& shape : shapes) {
+        benchmark->ArgsProduct({{shape[0]}, {shape[1]}, normalizations, plan_reuse});
+    }
+}
+
+// A single large transform and a batch-heavy shape of many small transforms, for each rank
+void shapes_1d(benchmark::internal::Benchmark* const benchmark)
+{
+    register_shapes(benchmark, {{1 << 20, 1}, {1 << 10, 1 << 10}});
+}
+
+void shapes_2d(benchmark::internal::Benchmark* const benchmark)
+{
+    register_shapes(benchmark, {{1 << 10, 1}, {1 << 6, 1 << 8}});
+}
+
+void shapes_3d(benchmark::internal::Benchmark* const benchmark)
+{
+    register_shapes(benchmark, {{1 << 7, 1}, {1 << 5, 1 << 5}});
+}
+
+template <typename ExecSpace, typename Tin, typename... CDims>
+void fft_forward(benchmark::State& state)
+{
+    fft_transform<ddc::FFT_Direction::FORWARD, ExecSpace, Tin, CDims...>(state);
+}
+
+template <typename ExecSpace, typename Tin, typename... CDims>
+void fft_backward(benchmark::State& state)
+{
+    fft_transform<ddc::FFT_Direction::BACKWARD, ExecSpace, Tin, CDims...>(state);
+}
+
+} // namespace anonymous_namespace_workaround_fft_cpp
+
+// NOLINTBEGIN(misc-use-anonymous-namespace)
+#define DDC_BENCHMARK_FFT(Function, ExecSpace)                                                     \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, double, X)                                             \
+            ->Apply(shapes_1d)                                                                     \
+            ->UseRealTime();                                                                       \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, Kokkos::complex<double>, X)                            \
+            ->Apply(shapes_1d)                                                                     \
+            ->UseRealTime();                                                                       \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, double, X, Y)                                          \
+            ->Apply(shapes_2d)                                                                     \
+            ->UseRealTime();                                                                       \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, Kokkos::complex<double>, X, Y)                         \
+            ->Apply(shapes_2d)                                                                     \
+            ->UseRealTime();                                                                       \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, double, X, Y, Z)                                       \
+            ->Apply(shapes_3d)                                                                     \
+            ->UseRealTime();                                                                       \
+    BENCHMARK_TEMPLATE(Function, ExecSpace, Kokkos::complex<double>, X, Y, Z)                      \
+            ->Apply(shapes_3d)                                                                     \
+            ->UseRealTime()
+
+#if defined(DDC_BENCHMARK_FFT_SERIAL)
+DDC_BENCHMARK_FFT(fft_forward, Kokkos::Serial);
+DDC_BENCHMARK_FFT(fft_backward, Kokkos::Serial);
+#endif
+#if defined(DDC_BENCHMARK_FFT_OPENMP)
+DDC_BENCHMARK_FFT(fft_forward, Kokkos::OpenMP);
+DDC_BENCHMARK_FFT(fft_backward, Kokkos::OpenMP);
+#endif
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) || defined(KOKKOS_ENABLE_SYCL)
+DDC_BENCHMARK_FFT(fft_forward, Kokkos::DefaultExecutionSpace);
+DDC_BENCHMARK_FFT(fft_backward, Kokkos::DefaultExecutionSpace);
+#endif
+// NOLINTEND(misc-use-anonymous-namespace)
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::AddCustomContext(
+            "normalizations",
+            "0: OFF, 1: FORWARD, 2: BACKWARD, 3: ORTHO, 4: FULL");
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    {
+        Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+        ddc::ScopeGuard const ddc_scope(argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+    }
+    ::benchmark::Shutdown();
+    return 0;
+}
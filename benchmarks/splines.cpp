@@ -109,6 +109,9 @@ void characteristics_advection_unitary(benchmark::State& state)
             std::ref(mutex),
             std::ref(monitorFlag),
             std::ref(maxUsedMem));
+    // Backend-agnostic high-water mark of the allocations made by DDC
+    ddc::reset_memory_usage_peaks();
+    std::size_t const init_ddc_mem = ddc::memory_usage().current_bytes;
 
     if constexpr (!IsNonUniform) {
         ddc::init_discrete_space<BSplinesX<
@@ -204,6 +207,7 @@ void characteristics_advection_unitary(benchmark::State& state)
     monitorThread.join();
     state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(nx * ny * sizeof(double)));
     state.counters["gpu_mem_occupancy"] = maxUsedMem - initUsedMem;
+    state.counters["ddc_peak_mem"] = ddc::memory_usage().peak_bytes - init_ddc_mem;
     ////////////////////////////////////////////////////
     /// --------------- HUGE WARNING --------------- ///
     /// The following lines are forbidden in a prod- ///
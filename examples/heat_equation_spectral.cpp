@@ -161,9 +161,24 @@ int main(int argc, char** argv)
 
     ddc::DiscreteDomain<DDimFx, DDimFy> const k_mesh
             = ddc::fourier_mesh<DDimFx, DDimFy>(xy_domain, false);
-    ddc::Chunk
-            Ff_allocation("Ff_allocation", k_mesh, ddc::DeviceAllocator<Kokkos::complex<double>>());
-    ddc::ChunkSpan const Ff = Ff_allocation.span_view();
+
+    // The FFT plans and the spectral workspace are built once and reused at each time-step
+    Kokkos::DefaultExecutionSpace const execution_space;
+    ddc::SpectralOperator heat_operator(
+            execution_space,
+            _next_temp.span_view(),
+            _last_temp.span_view(),
+            k_mesh,
+            {ddc::FFT_Normalization::BACKWARD});
+    auto const symbol = KOKKOS_LAMBDA(ddc::DiscreteElement<DDimFx, DDimFy> const ikxky)
+    {
+        ddc::DiscreteElement<DDimFx> const ikx(ikxky);
+        ddc::DiscreteElement<DDimFy> const iky(ikxky);
+        double const rkx = ddc::coordinate(ikx);
+        double const rky = ddc::coordinate(iky);
+        double const amplification = 1 - (kx * rkx * rkx + ky * rky * rky) * dt;
+        return amplification;
+    };
 
     for (ddc::DiscreteElement<DDimT> const iter :
          time_domain.remove_first(ddc::DiscreteVector<DDimT>(1))) {
@@ -173,21 +188,8 @@ int main(int argc, char** argv)
         // a read-only view of the temperature at the previous time-step
         ddc::ChunkSpan const last_temp = _last_temp.span_view();
 
-        // Stencil computation on the main domain
-        ddc::kwArgs_fft const kwargs {ddc::FFT_Normalization::BACKWARD};
-        Kokkos::DefaultExecutionSpace const execution_space;
-        ddc::fft(execution_space, Ff, last_temp, kwargs);
-        ddc::parallel_for_each(
-                execution_space,
-                k_mesh,
-                KOKKOS_LAMBDA(ddc::DiscreteElement<DDimFx, DDimFy> const ikxky) {
-                    ddc::DiscreteElement<DDimFx> const ikx(ikxky);
-                    ddc::DiscreteElement<DDimFy> const iky(ikxky);
-                    double const rkx = ddc::coordinate(ikx);
-                    double const rky = ddc::coordinate(iky);
-                    Ff(ikxky) *= 1 - (kx * rkx * rkx + ky * rky * rky) * dt;
-                });
-        ddc::ifft(execution_space, next_temp, Ff, kwargs);
+        // Spectral computation on the main domain: FFT, multiplication by the symbol and iFFT
+        heat_operator(next_temp, last_temp, symbol);
 
         if (iter - last_output >= t_output_period) {
             last_output = iter;
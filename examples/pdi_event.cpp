@@ -64,9 +64,11 @@ plugins:
         ddc::parallel_fill(chunk, 3);
 
         // Use the DDC API to expose a read-only 2D `ddc::ChunkSpan`.
-        // It exposes three related variables:
+        // It exposes five related variables:
         // - `pdi_chunk_label_rank`, the number of dimensions
         // - `pdi_chunk_label_extents`, the size of each dimension
+        // - `pdi_chunk_label_strides`, the stride in elements of each dimension
+        // - `pdi_chunk_label_start`, the front of the domain
         // - `pdi_chunk_label`, the pointer to the raw data
         // see `pdi_cfg` for the corresponding PDI types
         ddc::PdiEvent("some_event").with("pdi_chunk_label", chunk.span_cview());
@@ -0,0 +1,362 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/type_seq.hpp"
+
+#include "chunk.hpp"
+#include "chunk_span.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+#include "kokkos_allocator.hpp"
+#include "parallel_deepcopy.hpp"
+#include "parallel_fill.hpp"
+
+namespace ddc {
+
+/// A list of tags naming the fields of a `ChunkBundle`
+template <class... Fields>
+struct FieldList
+{
+};
+
+namespace detail {
+
+/// The discrete dimension indexing the fields of a `ChunkBundle`
+template <class... Fields>
+struct ChunkBundleFieldDim
+{
+};
+
+template <class FieldDim, class SupportType>
+struct ChunkBundleStorageDomain;
+
+template <class FieldDim, class... DDims>
+struct ChunkBundleStorageDomain<FieldDim, DiscreteDomain<DDims...>>
+{
+    using type = DiscreteDomain<FieldDim, DDims...>;
+};
+
+} // namespace detail
+
+template <
+        class ElementType,
+        class SupportType,
+        class FieldListType,
+        class Allocator = HostAllocator<ElementType>>
+class ChunkBundle;
+
+/** A set of fields sharing the same element type and the same domain, stored in a single
+ * allocation in structure-of-arrays form.
+ *
+ * Each field is contiguous and accessible as a `ChunkSpan` over `SupportType` with `get`.
+ * The whole storage is also accessible as a single `ChunkSpan` whose first dimension
+ * indexes the fields, so that bundle-wide operations run as a single kernel or transfer.
+ */
+template <class ElementType, class SupportType, class Allocator, class... Fields>
+class ChunkBundle<ElementType, SupportType, FieldList<Fields...>, Allocator>
+{
+    static_assert(sizeof...(Fields) > 0, "A ChunkBundle needs at least one field");
+
+public:
+    using field_dimension_type = detail::ChunkBundleFieldDim<Fields...>;
+
+    using storage_domain_type =
+            typename detail::ChunkBundleStorageDomain<field_dimension_type, SupportType>::type;
+
+    using storage_type = Chunk<ElementType, storage_domain_type, Allocator>;
+
+    using memory_space = typename Allocator::memory_space;
+
+    /// type of a span of a single field
+    using span_type = ChunkSpan<ElementType, SupportType, Kokkos::layout_right, memory_space>;
+
+    /// type of a view of a single field
+    using view_type
+            = ChunkSpan<ElementType const, SupportType, Kokkos::layout_right, memory_space>;
+
+    /// type of a span of all the fields
+    using storage_span_type = typename storage_type::span_type;
+
+    /// type of a view of all the fields
+    using storage_view_type = typename storage_type::view_type;
+
+    using discrete_domain_type = SupportType;
+
+    using element_type = ElementType;
+
+    using allocator_type = Allocator;
+
+private:
+    storage_type m_storage;
+
+    static storage_domain_type make_storage_domain(SupportType const& domain)
+    {
+        DiscreteDomain<field_dimension_type> const fields(
+                DiscreteElement<field_dimension_type>(0),
+                DiscreteVector<field_dimension_type>(sizeof...(Fields)));
+        return storage_domain_type(fields, domain);
+    }
+
+    template <class Field>
+    static constexpr std::size_t field_index() noexcept
+    {
+        static_assert(in_tags_v<Field, detail::TypeSeq<Fields...>>, "Unknown field");
+        return type_seq_rank_v<Field, detail::TypeSeq<Fields...>>;
+    }
+
+public:
+    static constexpr std::size_t nb_fields() noexcept
+    {
+        return sizeof...(Fields);
+    }
+
+    /// Empty ChunkBundle
+    ChunkBundle() = default;
+
+    /// Construct a labeled ChunkBundle on a domain with uninitialized values
+    explicit ChunkBundle(
+            std::string const& label,
+            SupportType const& domain,
+            Allocator allocator = Allocator())
+        : m_storage(label, make_storage_domain(domain), std::move(allocator))
+    {
+    }
+
+    /// Construct a ChunkBundle on a domain with uninitialized values
+    explicit ChunkBundle(SupportType const& domain, Allocator allocator = Allocator())
+        : ChunkBundle("no-label", domain, std::move(allocator))
+    {
+    }
+
+    /// Deleted: use deepcopy instead
+    ChunkBundle(ChunkBundle const& other) = delete;
+
+    ChunkBundle(ChunkBundle&& other) noexcept = default;
+
+    ~ChunkBundle() noexcept = default;
+
+    /// Deleted: use deepcopy instead
+    ChunkBundle& operator=(ChunkBundle const& other) = delete;
+
+    ChunkBundle& operator=(ChunkBundle&& other) noexcept = default;
+
+    /// @return the domain shared by all the fields
+    SupportType domain() const noexcept
+    {
+        return SupportType(m_storage.domain());
+    }
+
+    /// @return a span of the field `Field`
+    template <class Field>
+    span_type get() noexcept
+    {
+        SupportType const dom = domain();
+        return span_type(m_storage.data_handle() + field_index<Field>() * dom.size(), dom);
+    }
+
+    /// @return a view of the field `Field`
+    template <class Field>
+    view_type get() const noexcept
+    {
+        SupportType const dom = domain();
+        return view_type(m_storage.data_handle() + field_index<Field>() * dom.size(), dom);
+    }
+
+    /// @return a view of all the fields, the first dimension indexes the fields
+    storage_view_type span_cview() const
+    {
+        return m_storage.span_cview();
+    }
+
+    /// @return a view of all the fields, the first dimension indexes the fields
+    storage_view_type span_view() const
+    {
+        return m_storage.span_view();
+    }
+
+    /// @return a span of all the fields, the first dimension indexes the fields
+    storage_span_type span_view()
+    {
+        return m_storage.span_view();
+    }
+};
+
+/** Fill all the fields of a bundle with a given value in a single kernel
+ * @param[out] dst the bundle to fill
+ * @param[in]  value the value to fill `dst`
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <class ElementType, class SupportType, class FieldListType, class Allocator, class T>
+auto parallel_fill(
+        ChunkBundle<ElementType, SupportType, FieldListType, Allocator>& dst,
+        T const& value)
+{
+    return parallel_fill(dst.span_view(), value);
+}
+
+/** Fill all the fields of a bundle with a given value in a single kernel
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] dst the bundle to fill
+ * @param[in]  value the value to fill `dst`
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <
+        class ExecSpace,
+        class ElementType,
+        class SupportType,
+        class FieldListType,
+        class Allocator,
+        class T>
+auto parallel_fill(
+        ExecSpace const& execution_space,
+        ChunkBundle<ElementType, SupportType, FieldListType, Allocator>& dst,
+        T const& value)
+{
+    return parallel_fill(execution_space, dst.span_view(), value);
+}
+
+/** Copy all the fields of a bundle into another in a single transfer
+ * @param[out] dst the bundle in which to copy
+ * @param[in]  src the bundle from which to copy
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <
+        class ElementTypeDst,
+        class ElementTypeSrc,
+        class SupportType,
+        class FieldListType,
+        class AllocatorDst,
+        class AllocatorSrc>
+auto parallel_deepcopy(
+        ChunkBundle<ElementTypeDst, SupportType, FieldListType, AllocatorDst>& dst,
+        ChunkBundle<ElementTypeSrc, SupportType, FieldListType, AllocatorSrc> const& src)
+{
+    return parallel_deepcopy(dst.span_view(), src.span_cview());
+}
+
+/** Copy all the fields of a bundle into another in a single transfer
+ * @param[out] dst the bundle in which to copy
+ * @param[in]  src the bundle from which to copy
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <
+        class ElementTypeDst,
+        class ElementTypeSrc,
+        class SupportType,
+        class FieldListType,
+        class AllocatorDst,
+        class AllocatorSrc>
+auto parallel_deepcopy(
+        ChunkBundle<ElementTypeDst, SupportType, FieldListType, AllocatorDst>& dst,
+        ChunkBundle<ElementTypeSrc, SupportType, FieldListType, AllocatorSrc>& src)
+{
+    return parallel_deepcopy(dst.span_view(), src.span_cview());
+}
+
+/** Copy all the fields of a bundle into another in a single transfer
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] dst the bundle in which to copy
+ * @param[in]  src the bundle from which to copy
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <
+        class ExecSpace,
+        class ElementTypeDst,
+        class ElementTypeSrc,
+        class SupportType,
+        class FieldListType,
+        class AllocatorDst,
+        class AllocatorSrc>
+auto parallel_deepcopy(
+        ExecSpace const& execution_space,
+        ChunkBundle<ElementTypeDst, SupportType, FieldListType, AllocatorDst>& dst,
+        ChunkBundle<ElementTypeSrc, SupportType, FieldListType, AllocatorSrc> const& src)
+{
+    return parallel_deepcopy(execution_space, dst.span_view(), src.span_cview());
+}
+
+/** Copy all the fields of a bundle into another in a single transfer
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[out] dst the bundle in which to copy
+ * @param[in]  src the bundle from which to copy
+ * @return dst as a ChunkSpan of all the fields
+ */
+template <
+        class ExecSpace,
+        class ElementTypeDst,
+        class ElementTypeSrc,
+        class SupportType,
+        class FieldListType,
+        class AllocatorDst,
+        class AllocatorSrc>
+auto parallel_deepcopy(
+        ExecSpace const& execution_space,
+        ChunkBundle<ElementTypeDst, SupportType, FieldListType, AllocatorDst>& dst,
+        ChunkBundle<ElementTypeSrc, SupportType, FieldListType, AllocatorSrc>& src)
+{
+    return parallel_deepcopy(execution_space, dst.span_view(), src.span_cview());
+}
+
+/// @param[in] space A Kokkos memory space or execution space.
+/// @param[in] src A ChunkBundle.
+/// @return a `ChunkBundle` with the same fields and support as `src` allocated on the `Space::memory_space` memory space.
+template <class Space, class ElementType, class SupportType, class FieldListType, class Allocator>
+auto create_mirror(
+        [[maybe_unused]] Space const& space,
+        ChunkBundle<ElementType, SupportType, FieldListType, Allocator> const& src)
+{
+    static_assert(
+            Kokkos::is_memory_space_v<Space> || Kokkos::is_execution_space_v<Space>,
+            "DDC: parameter \"Space\" must be either a Kokkos execution space or a memory space");
+    using element_type = std::remove_const_t<ElementType>;
+    return ChunkBundle<
+            element_type,
+            SupportType,
+            FieldListType,
+            KokkosAllocator<element_type, typename Space::memory_space>>(src.domain());
+}
+
+/// Equivalent to `create_mirror(Kokkos::HostSpace(), src)`.
+/// @param[in] src A ChunkBundle.
+/// @return a `ChunkBundle` with the same fields and support as `src` allocated on the `Kokkos::HostSpace` memory space.
+template <class ElementType, class SupportType, class FieldListType, class Allocator>
+auto create_mirror(ChunkBundle<ElementType, SupportType, FieldListType, Allocator> const& src)
+{
+    return create_mirror(Kokkos::HostSpace(), src);
+}
+
+/// @param[in] space A Kokkos memory space or execution space.
+/// @param[in] src A ChunkBundle.
+/// @return a `ChunkBundle` with the same fields and support as `src` allocated on the `Space::memory_space` memory space and operates a single deep copy between the two.
+template <class Space, class ElementType, class SupportType, class FieldListType, class Allocator>
+auto create_mirror_and_copy(
+        Space const& space,
+        ChunkBundle<ElementType, SupportType, FieldListType, Allocator> const& src)
+{
+    auto bundle = create_mirror(space, src);
+    parallel_deepcopy(bundle, src);
+    return bundle;
+}
+
+/// Equivalent to `create_mirror_and_copy(Kokkos::HostSpace(), src)`.
+/// @param[in] src A ChunkBundle.
+/// @return a `ChunkBundle` with the same fields and support as `src` allocated on the `Kokkos::HostSpace` memory space and operates a single deep copy between the two.
+template <class ElementType, class SupportType, class FieldListType, class Allocator>
+auto create_mirror_and_copy(
+        ChunkBundle<ElementType, SupportType, FieldListType, Allocator> const& src)
+{
+    return create_mirror_and_copy(Kokkos::HostSpace(), src);
+}
+
+} // namespace ddc
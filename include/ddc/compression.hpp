@@ -0,0 +1,364 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/memory_mapping.hpp"
+
+#include "chunk_span.hpp"
+#include "discrete_domain.hpp"
+#include "io.hpp"
+
+namespace ddc::io {
+
+/// Figures of a compressed write or read
+struct CompressionStats
+{
+    std::size_t raw_bytes = 0;
+
+    std::size_t compressed_bytes = 0;
+
+    double seconds = 0;
+
+    /// @return the raw size divided by the compressed size
+    double ratio() const noexcept
+    {
+        return compressed_bytes == 0 ? 0 : double(raw_bytes) / double(compressed_bytes);
+    }
+
+    /// @return the raw bytes processed per second, I/O included
+    double throughput() const noexcept
+    {
+        return seconds == 0 ? 0 : double(raw_bytes) / seconds;
+    }
+};
+
+namespace detail {
+
+inline constexpr char s_compressed_magic[8] = {'D', 'D', 'C', 'C', 'M', 'P', 'R', 'S'};
+
+inline constexpr std::uint32_t s_compressed_version = 1;
+
+/// Fixed-size part of the header of a compressed chunk file
+struct CompressedChunkHeader
+{
+    char magic[8];
+
+    std::uint32_t version;
+
+    std::uint32_t rank;
+
+    std::uint64_t element_size;
+
+    std::uint64_t block_size;
+
+    std::uint64_t nb_blocks;
+
+    std::uint64_t description_size;
+};
+
+/// Upper bound of the compressed size of `size` bytes
+inline constexpr std::size_t max_compressed_size(std::size_t const size) noexcept
+{
+    return size + size / 128 + 1;
+}
+
+/** Lossless floating-point aware compression of `n` elements of `element_size` bytes.
+ *
+ * Each element is XORed with the previous one so that the identical leading bytes (sign,
+ * exponent and high mantissa bits of slowly varying floats) vanish. The bytes are then shuffled by
+ * significance and the zero runs are encoded: a control byte `c < 128` is followed by `c + 1`
+ * literal bytes and `c >= 128` stands for `c - 127` zero bytes.
+ *
+ * @return the number of bytes written in `out`, at most `max_compressed_size(n * element_size)`
+ */
+inline std::size_t compress_block(
+        unsigned char const* const in,
+        std::size_t const n,
+        std::size_t const element_size,
+        unsigned char* const out,
+        unsigned char* const scratch)
+{
+    std::size_t const size = n * element_size;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t b = 0; b < element_size; ++b) {
+            unsigned char const previous = i == 0 ? 0 : in[(i - 1) * element_size + b];
+            scratch[b * n + i] = in[i * element_size + b] ^ previous;
+        }
+    }
+    std::size_t pos = 0;
+    std::size_t i = 0;
+    while (i < size) {
+        std::size_t run = 0;
+        while (i + run < size && run < 128 && scratch[i + run] == 0) {
+            ++run;
+        }
+        if (run > 0) {
+            out[pos++] = static_cast<unsigned char>(127 + run);
+            i += run;
+            continue;
+        }
+        // Literals up to the next pair of zeros, a single zero costs less as a literal
+        std::size_t const literal_begin = i;
+        while (i < size && i - literal_begin < 128
+               && !(scratch[i] == 0 && i + 1 < size && scratch[i + 1] == 0)) {
+            ++i;
+        }
+        std::size_t const length = i - literal_begin;
+        out[pos++] = static_cast<unsigned char>(length - 1);
+        std::memcpy(out + pos, scratch + literal_begin, length);
+        pos += length;
+    }
+    return pos;
+}
+
+/// Inverse of `compress_block`, throws if `in` does not decode to `n` elements
+inline void decompress_block(
+        unsigned char const* const in,
+        std::size_t const in_size,
+        std::size_t const n,
+        std::size_t const element_size,
+        unsigned char* const out,
+        unsigned char* const scratch)
+{
+    std::size_t const size = n * element_size;
+    std::size_t pos = 0;
+    std::size_t i = 0;
+    while (pos < in_size) {
+        unsigned char const c = in[pos++];
+        std::size_t const length = c < 128 ? c + 1 : c - 127;
+        if (i + length > size || (c < 128 && pos + length > in_size)) {
+            throw std::runtime_error("Corrupted compressed block");
+        }
+        if (c < 128) {
+            std::memcpy(scratch + i, in + pos, length);
+            pos += length;
+        } else {
+            std::memset(scratch + i, 0, length);
+        }
+        i += length;
+    }
+    if (i != size) {
+        throw std::runtime_error("Corrupted compressed block");
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t b = 0; b < element_size; ++b) {
+            unsigned char const previous = j == 0 ? 0 : out[(j - 1) * element_size + b];
+            out[j * element_size + b] = scratch[b * n + j] ^ previous;
+        }
+    }
+}
+
+} // namespace detail
+
+/** Write a chunk in a compressed file readable by `read_compressed_chunk`.
+ *
+ * The data is split into blocks of about `block_size` bytes compressed in parallel on the host
+ * execution space with a lossless floating-point aware scheme, see `detail::compress_block`.
+ *
+ * This is only available on POSIX systems.
+ */
+template <class ElementType, class SupportType, class MemorySpace>
+CompressionStats write_compressed_chunk(
+        std::string const& path,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& data,
+        std::size_t const block_size = std::size_t(1) << 20)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemorySpace>::accessible,
+            "The chunk must be accessible from the host");
+    static_assert(std::is_trivially_copyable_v<std::remove_const_t<ElementType>>);
+    Kokkos::Timer const timer;
+    std::size_t const element_size = sizeof(ElementType);
+    std::size_t const block_elements = std::max(block_size / element_size, std::size_t(1));
+    std::size_t const n = data.size();
+    std::size_t const nb_blocks = (n + block_elements - 1) / block_elements;
+    unsigned char const* const in = reinterpret_cast<unsigned char const*>(data.data_handle());
+
+    std::vector<std::vector<unsigned char>> blocks(nb_blocks);
+    std::vector<std::uint64_t> compressed_sizes(nb_blocks);
+    Kokkos::parallel_for(
+            "ddc_compress_blocks",
+            Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nb_blocks),
+            [&](std::size_t const ib) {
+                std::size_t const begin = ib * block_elements;
+                std::size_t const length = std::min(block_elements, n - begin);
+                std::vector<unsigned char> scratch(length * element_size);
+                blocks[ib].resize(detail::max_compressed_size(length * element_size));
+                compressed_sizes[ib] = detail::compress_block(
+                        in + begin * element_size,
+                        length,
+                        element_size,
+                        blocks[ib].data(),
+                        scratch.data());
+            });
+    // Kokkos::parallel_for is asynchronous, even on the host
+    Kokkos::DefaultHostExecutionSpace().fence("ddc_compress_blocks");
+
+    std::string const description = detail::chunk_description<ElementType>(data.domain());
+    detail::CompressedChunkHeader header;
+    std::memcpy(header.magic, detail::s_compressed_magic, sizeof(header.magic));
+    header.version = detail::s_compressed_version;
+    header.rank = SupportType::rank();
+    header.element_size = element_size;
+    header.block_size = block_elements * element_size;
+    header.nb_blocks = nb_blocks;
+    header.description_size = description.size();
+    std::vector<std::uint64_t> dims;
+    for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+        dims.push_back(ddc::detail::array(data.domain().front())[i]);
+        dims.push_back(ddc::detail::array(data.domain().extents())[i]);
+    }
+
+    std::vector<unsigned char> buffer(sizeof(header));
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    auto const append = [&](void const* const p, std::size_t const size) {
+        unsigned char const* const bytes = static_cast<unsigned char const*>(p);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+    append(dims.data(), dims.size() * sizeof(std::uint64_t));
+    append(description.data(), description.size());
+    append(compressed_sizes.data(), compressed_sizes.size() * sizeof(std::uint64_t));
+    for (std::size_t ib = 0; ib < nb_blocks; ++ib) {
+        append(blocks[ib].data(), compressed_sizes[ib]);
+    }
+
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot create " + path, errno);
+    }
+    std::byte* const bytes = reinterpret_cast<std::byte*>(buffer.data());
+    int const err = detail::full_pio<true>(fd.get(), bytes, buffer.size(), 0);
+    if (err != 0) {
+        throw ddc::detail::system_error("Cannot write " + path, err);
+    }
+    return CompressionStats {n * element_size, buffer.size(), timer.seconds()};
+}
+
+/// Read a file written by `write_compressed_chunk` into `data`, whose domain must match
+template <class ElementType, class SupportType, class MemorySpace>
+CompressionStats read_compressed_chunk(
+        std::string const& path,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& data)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemorySpace>::accessible,
+            "The chunk must be accessible from the host");
+    static_assert(!std::is_const_v<ElementType>, "Cannot read into a constant chunk");
+    Kokkos::Timer const timer;
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_RDONLY));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot open " + path, errno);
+    }
+    std::vector<unsigned char> buffer(fd.file_size());
+    std::byte* const bytes = reinterpret_cast<std::byte*>(buffer.data());
+    if (detail::full_pio<false>(fd.get(), bytes, buffer.size(), 0) != 0) {
+        throw std::runtime_error("Cannot read " + path);
+    }
+
+    detail::CompressedChunkHeader header;
+    if (buffer.size() < sizeof(header)) {
+        throw std::runtime_error(path + " is not a compressed chunk file");
+    }
+    std::memcpy(&header, buffer.data(), sizeof(header));
+    if (std::memcmp(header.magic, detail::s_compressed_magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error(path + " is not a compressed chunk file");
+    }
+    if (header.version != detail::s_compressed_version) {
+        throw std::runtime_error(path + ": unsupported compressed chunk version");
+    }
+    if (header.rank != SupportType::rank()) {
+        throw std::runtime_error(path + ": rank mismatch");
+    }
+    std::size_t const element_size = sizeof(ElementType);
+    std::size_t const block_elements = header.block_size / element_size;
+    if (block_elements == 0 || block_elements * element_size != header.block_size) {
+        throw std::runtime_error(path + ": corrupted compressed chunk file");
+    }
+    std::size_t const n = data.size();
+    std::size_t const nb_blocks = header.nb_blocks;
+    std::size_t const dims_size = 2 * SupportType::rank() * sizeof(std::uint64_t);
+    // The sizes read from the file are checked one by one against the remaining bytes so that
+    // the offsets cannot overflow
+    if (buffer.size() - sizeof(header) < dims_size
+        || buffer.size() - sizeof(header) - dims_size < header.description_size) {
+        throw std::runtime_error(path + ": truncated compressed chunk file");
+    }
+    std::size_t const table_offset = sizeof(header) + dims_size + header.description_size;
+    if ((buffer.size() - table_offset) / sizeof(std::uint64_t) < nb_blocks) {
+        throw std::runtime_error(path + ": truncated compressed chunk file");
+    }
+
+    detail::ChunkFileHeader file_header {header.element_size, 0, {}, {}, {}};
+    std::vector<std::uint64_t> dims(2 * SupportType::rank());
+    std::memcpy(dims.data(), buffer.data() + sizeof(header), dims_size);
+    for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+        file_header.front.push_back(dims[2 * i]);
+        file_header.extents.push_back(dims[2 * i + 1]);
+    }
+    file_header.description.assign(
+            reinterpret_cast<char const*>(buffer.data() + sizeof(header) + dims_size),
+            header.description_size);
+    if (detail::checked_domain<ElementType, SupportType>(file_header, path) != data.domain()) {
+        throw std::runtime_error(path + ": domain mismatch");
+    }
+    if (nb_blocks != (n + block_elements - 1) / block_elements) {
+        throw std::runtime_error(path + ": corrupted compressed chunk file");
+    }
+
+    std::vector<std::uint64_t> offsets(nb_blocks + 1);
+    offsets[0] = table_offset + nb_blocks * sizeof(std::uint64_t);
+    for (std::size_t ib = 0; ib < nb_blocks; ++ib) {
+        std::uint64_t compressed_size;
+        std::memcpy(
+                &compressed_size,
+                buffer.data() + table_offset + ib * sizeof(std::uint64_t),
+                sizeof(compressed_size));
+        if (compressed_size > buffer.size() - offsets[ib]) {
+            throw std::runtime_error(path + ": truncated compressed chunk file");
+        }
+        offsets[ib + 1] = offsets[ib] + compressed_size;
+    }
+
+    unsigned char* const out = reinterpret_cast<unsigned char*>(data.data_handle());
+    int nb_corrupted = 0;
+    Kokkos::parallel_reduce(
+            "ddc_decompress_blocks",
+            Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nb_blocks),
+            [&](std::size_t const ib, int& corrupted) {
+                std::size_t const begin = ib * block_elements;
+                std::size_t const length = std::min(block_elements, n - begin);
+                std::vector<unsigned char> scratch(length * element_size);
+                try {
+                    detail::decompress_block(
+                            buffer.data() + offsets[ib],
+                            offsets[ib + 1] - offsets[ib],
+                            length,
+                            element_size,
+                            out + begin * element_size,
+                            scratch.data());
+                } catch (std::runtime_error const&) {
+                    ++corrupted;
+                }
+            },
+            nb_corrupted);
+    if (nb_corrupted != 0) {
+        throw std::runtime_error(path + ": corrupted compressed chunk file");
+    }
+    return CompressionStats {n * element_size, buffer.size(), timer.seconds()};
+}
+
+} // namespace ddc::io
@@ -0,0 +1,279 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/type_traits.hpp"
+
+#include "chunk_span.hpp"
+#include "chunk_traits.hpp"
+#include "discrete_element.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Proxy reference converting between the storage type and the compute type on each access
+template <class StorageType, class ComputeType>
+class ConvertingReference
+{
+    StorageType* m_ptr;
+
+public:
+    KOKKOS_FUNCTION constexpr explicit ConvertingReference(StorageType* const ptr) noexcept
+        : m_ptr(ptr)
+    {
+    }
+
+    KOKKOS_DEFAULTED_FUNCTION constexpr ConvertingReference(ConvertingReference const& other)
+            = default;
+
+    KOKKOS_FUNCTION constexpr operator ComputeType() const
+    {
+        return static_cast<ComputeType>(*m_ptr);
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator=(ComputeType const& value) const
+    {
+        *m_ptr = static_cast<StorageType>(value);
+        return *this;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator=(
+            ConvertingReference const& other) const
+    {
+        return *this = static_cast<ComputeType>(other);
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator+=(ComputeType const& value) const
+    {
+        return *this = static_cast<ComputeType>(*this) + value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator-=(ComputeType const& value) const
+    {
+        return *this = static_cast<ComputeType>(*this) - value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator*=(ComputeType const& value) const
+    {
+        return *this = static_cast<ComputeType>(*this) * value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator/=(ComputeType const& value) const
+    {
+        return *this = static_cast<ComputeType>(*this) / value;
+    }
+};
+
+} // namespace detail
+
+/** An mdspan accessor policy storing elements as `StorageType` while reads and writes are done
+ * in `ComputeType`.
+ *
+ * `StorageType` is typically a reduced precision type such as `float`,
+ * `Kokkos::Experimental::half_t` or `Kokkos::Experimental::bhalf_t` and `ComputeType` is
+ * typically `double`. A const `StorageType` gives a read-only accessor.
+ */
+template <class StorageType, class ComputeType>
+struct ConvertingAccessor
+{
+    using offset_policy = ConvertingAccessor;
+
+    using element_type
+            = std::conditional_t<std::is_const_v<StorageType>, ComputeType const, ComputeType>;
+
+    using reference = std::conditional_t<
+            std::is_const_v<StorageType>,
+            ComputeType,
+            detail::ConvertingReference<StorageType, ComputeType>>;
+
+    using data_handle_type = StorageType*;
+
+    KOKKOS_DEFAULTED_FUNCTION constexpr ConvertingAccessor() = default;
+
+    template <
+            class OStorageType,
+            std::enable_if_t<std::is_convertible_v<OStorageType (*)[], StorageType (*)[]>, int>
+            = 0>
+    KOKKOS_FUNCTION constexpr ConvertingAccessor(
+            ConvertingAccessor<OStorageType, ComputeType> const&) noexcept
+    {
+    }
+
+    KOKKOS_FUNCTION constexpr reference access(data_handle_type p, std::size_t i) const
+    {
+        if constexpr (std::is_const_v<StorageType>) {
+            return static_cast<ComputeType>(p[i]);
+        } else {
+            return reference(p + i);
+        }
+    }
+
+    KOKKOS_FUNCTION constexpr data_handle_type offset(data_handle_type p, std::size_t i) const
+    {
+        return p + i;
+    }
+};
+
+/** A view of a `ChunkSpan` of `StorageType` elements accessed as `ComputeType` elements.
+ *
+ * The storage keeps the reduced precision so memory traffic is reduced, the conversions
+ * happen in registers on each access. Allocation, deep copies and Kokkos views are those of
+ * the underlying storage `ChunkSpan`.
+ */
+template <
+        class ComputeType,
+        class StorageType,
+        class SupportType,
+        class LayoutStridedPolicy = Kokkos::layout_right,
+        class MemorySpace = Kokkos::DefaultHostExecutionSpace::memory_space>
+class ConvertingChunkSpan
+{
+public:
+    using storage_span_type = ChunkSpan<StorageType, SupportType, LayoutStridedPolicy, MemorySpace>;
+
+    using accessor_type = ConvertingAccessor<StorageType, ComputeType>;
+
+    using discrete_domain_type = SupportType;
+
+    using memory_space = MemorySpace;
+
+    using element_type = typename accessor_type::element_type;
+
+    using value_type = std::remove_cv_t<ComputeType>;
+
+    using reference = typename accessor_type::reference;
+
+    using allocation_mdspan_type = Kokkos::mdspan<
+            element_type,
+            typename storage_span_type::extents_type,
+            typename storage_span_type::layout_type,
+            accessor_type>;
+
+private:
+    storage_span_type m_storage;
+
+public:
+    KOKKOS_DEFAULTED_FUNCTION constexpr ConvertingChunkSpan() = default;
+
+    KOKKOS_FUNCTION constexpr explicit ConvertingChunkSpan(storage_span_type const& storage)
+        : m_storage(storage)
+    {
+    }
+
+    KOKKOS_FUNCTION constexpr SupportType domain() const noexcept
+    {
+        return m_storage.domain();
+    }
+
+    KOKKOS_FUNCTION constexpr std::size_t size() const noexcept
+    {
+        return m_storage.size();
+    }
+
+    /** Element access using a list of DiscreteElement
+     * @param delems discrete elements
+     * @return a proxy reference converting to and from `ComputeType`
+     */
+    template <
+            class... DElems,
+            std::enable_if_t<detail::all_of_v<is_discrete_element_v<DElems>...>, int> = 0>
+    KOKKOS_FUNCTION constexpr reference operator()(DElems const&... delems) const noexcept
+    {
+        return accessor_type().access(&m_storage(delems...), 0);
+    }
+
+    /** Access to the underlying allocation pointer
+     * @return allocation pointer of the storage
+     */
+    KOKKOS_FUNCTION constexpr StorageType* data_handle() const
+    {
+        return m_storage.data_handle();
+    }
+
+    /** Provide a converting mdspan on the memory allocation
+     * @return allocation mdspan
+     */
+    KOKKOS_FUNCTION constexpr allocation_mdspan_type allocation_mdspan() const
+    {
+        return allocation_mdspan_type(
+                m_storage.data_handle(),
+                m_storage.allocation_mdspan().mapping());
+    }
+
+    /** Provide a Kokkos view on the memory allocation, in `StorageType`
+     * @return allocation Kokkos view
+     */
+    KOKKOS_FUNCTION constexpr auto allocation_kokkos_view() const
+    {
+        return m_storage.allocation_kokkos_view();
+    }
+
+    /// @return the underlying storage span
+    KOKKOS_FUNCTION constexpr storage_span_type span_view() const
+    {
+        return m_storage;
+    }
+
+    /// @return the underlying storage span as read-only
+    KOKKOS_FUNCTION constexpr auto span_cview() const
+    {
+        return m_storage.span_cview();
+    }
+};
+
+template <
+        class ComputeType,
+        class StorageType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class MemorySpace>
+inline constexpr bool enable_chunk<ConvertingChunkSpan<
+        ComputeType,
+        StorageType,
+        SupportType,
+        LayoutStridedPolicy,
+        MemorySpace>> = true;
+
+template <
+        class ComputeType,
+        class StorageType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class MemorySpace>
+inline constexpr bool enable_borrowed_chunk<ConvertingChunkSpan<
+        ComputeType,
+        StorageType,
+        SupportType,
+        LayoutStridedPolicy,
+        MemorySpace>> = true;
+
+/** Access a reduced precision `ChunkSpan` in `ComputeType`
+ * @param[in] storage a `ChunkSpan` of reduced precision elements
+ * @return a `ConvertingChunkSpan` over the same memory
+ */
+template <
+        class ComputeType,
+        class StorageType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class MemorySpace>
+KOKKOS_FUNCTION constexpr auto make_converting_chunk_span(
+        ChunkSpan<StorageType, SupportType, LayoutStridedPolicy, MemorySpace> const& storage)
+{
+    return ConvertingChunkSpan<
+            ComputeType,
+            StorageType,
+            SupportType,
+            LayoutStridedPolicy,
+            MemorySpace>(storage);
+}
+
+} // namespace ddc
@@ -42,13 +42,17 @@ namespace ddc {
 
 #include "real_type.hpp"
 #include "scope_guard.hpp"
+#include "tuning.hpp"
 
 // Containers
 #include "aligned_allocator.hpp"
 #include "chunk.hpp"
+#include "chunk_bundle.hpp"
 #include "chunk_span.hpp"
 #include "chunk_traits.hpp"
+#include "converting_chunk_span.hpp"
 #include "kokkos_allocator.hpp"
+#include "memory_tracker.hpp"
 
 // Discretizations
 #include "discrete_domain.hpp"
@@ -58,6 +62,7 @@ namespace ddc {
 #include "non_uniform_point_sampling.hpp"
 #include "periodic_sampling.hpp"
 #include "sparse_discrete_domain.hpp"
+#include "static_uniform_point_sampling.hpp"
 #include "strided_discrete_domain.hpp"
 #include "trivial_space.hpp"
 #include "uniform_point_sampling.hpp"
@@ -0,0 +1,420 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/memory_mapping.hpp"
+
+#include "chunk.hpp"
+#include "chunk_span.hpp"
+#include "create_mirror.hpp"
+#include "discrete_domain.hpp"
+#include "io.hpp"
+#include "kokkos_allocator.hpp"
+#include "parallel_deepcopy.hpp"
+#include "parallel_for_each.hpp"
+
+namespace ddc::io {
+
+namespace detail {
+
+/// Discrete dimension indexing the blocks of a delta checkpoint
+struct DeltaBlock
+{
+};
+
+/// Discrete dimension indexing the bytes of a block of a delta checkpoint
+struct DeltaByte
+{
+};
+
+inline constexpr char s_delta_magic[8] = {'D', 'D', 'C', 'D', 'E', 'L', 'T', 'A'};
+
+/// splitmix64 finalizer
+KOKKOS_FUNCTION inline std::uint64_t mix_hash(std::uint64_t h) noexcept
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+/** 64-bit hashes of the blocks of `block_size` bytes starting at `data`.
+ *
+ * A team of threads hashes each block, the hash of a block being the sum of the mixed 8-byte words
+ * of the block salted with their position, so that the words are hashed in parallel.
+ */
+template <class ExecSpace, class MemorySpace>
+void hash_blocks(
+        ExecSpace const& exec_space,
+        ChunkSpan<
+                std::uint64_t,
+                DiscreteDomain<DeltaBlock>,
+                Kokkos::layout_right,
+                MemorySpace> const& hashes,
+        unsigned char const* const data,
+        std::size_t const size,
+        std::size_t const block_size)
+{
+    using team_policy = Kokkos::TeamPolicy<ExecSpace>;
+    DiscreteElement<DeltaBlock> const first_block = hashes.domain().front();
+    Kokkos::parallel_for(
+            "ddc_delta_checkpoint_hash",
+            team_policy(exec_space, static_cast<int>(hashes.domain().size()), Kokkos::AUTO),
+            KOKKOS_LAMBDA(typename team_policy::member_type const& team) {
+                DiscreteElement<DeltaBlock> const ib
+                        = first_block + DiscreteVector<DeltaBlock>(team.league_rank());
+                std::size_t const begin = std::size_t(team.league_rank()) * block_size;
+                std::size_t const end = Kokkos::min(begin + block_size, size);
+                std::size_t const nb_words = (end - begin + 7) / 8;
+                std::uint64_t h = 0;
+                Kokkos::parallel_reduce(
+                        Kokkos::TeamThreadRange(team, nb_words),
+                        [&](std::size_t const iw, std::uint64_t& partial) {
+                            std::size_t const first = begin + 8 * iw;
+                            std::size_t const last = Kokkos::min(first + 8, end);
+                            std::uint64_t word = 0;
+                            for (std::size_t i = first; i < last; ++i) {
+                                word |= std::uint64_t(data[i]) << (8 * (i - first));
+                            }
+                            partial += mix_hash(word ^ mix_hash(iw));
+                        },
+                        h);
+                Kokkos::single(Kokkos::PerTeam(team), [&]() { hashes(ib) = h; });
+            });
+}
+
+/// Copy the blocks `indices` of the `size` bytes at `data` into the rows of `blocks`
+template <class ExecSpace, class MemorySpace>
+void gather_blocks(
+        ExecSpace const& exec_space,
+        ChunkSpan<
+                unsigned char,
+                DiscreteDomain<DeltaBlock, DeltaByte>,
+                Kokkos::layout_right,
+                MemorySpace> const& blocks,
+        ChunkSpan<
+                std::uint64_t const,
+                DiscreteDomain<DeltaBlock>,
+                Kokkos::layout_right,
+                MemorySpace> const& indices,
+        unsigned char const* const data,
+        std::size_t const size)
+{
+    DiscreteDomain<DeltaByte> const bytes(blocks.domain());
+    DiscreteElement<DeltaByte> const first_byte = bytes.front();
+    std::size_t const block_size = bytes.size();
+    parallel_for_each(
+            "ddc_delta_checkpoint_gather",
+            exec_space,
+            blocks.domain(),
+            KOKKOS_LAMBDA(DiscreteElement<DeltaBlock, DeltaByte> const i) {
+                std::size_t const src
+                        = indices(DiscreteElement<DeltaBlock>(i)) * block_size
+                          + (DiscreteElement<DeltaByte>(i) - first_byte).value();
+                blocks(i) = src < size ? data[src] : 0;
+            });
+}
+
+inline void checked_pio(
+        bool const write,
+        int const fd,
+        void* const data,
+        std::size_t const size,
+        std::size_t const offset,
+        std::string const& path)
+{
+    int const err
+            = write ? full_pio<true>(fd, static_cast<std::byte*>(data), size, off_t(offset))
+                    : full_pio<false>(fd, static_cast<std::byte*>(data), size, off_t(offset));
+    if (err != 0) {
+        throw ddc::detail::system_error((write ? "Cannot write " : "Cannot read ") + path, err);
+    }
+}
+
+/** Apply a delta file to the `size` bytes at `data`.
+ *
+ * A delta file holds the magic, the block size, the number of changed blocks, their indices and
+ * then their content, all the blocks being `block_size` bytes long except the last one of the data.
+ */
+inline void apply_delta(std::string const& path, std::byte* const data, std::size_t const size)
+{
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_RDONLY));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot open " + path, errno);
+    }
+    char magic[sizeof(s_delta_magic)];
+    std::uint64_t header[2];
+    checked_pio(false, fd.get(), magic, sizeof(magic), 0, path);
+    if (std::memcmp(magic, s_delta_magic, sizeof(magic)) != 0) {
+        throw std::runtime_error(path + " is not a delta checkpoint file");
+    }
+    checked_pio(false, fd.get(), header, sizeof(header), sizeof(magic), path);
+    std::size_t const block_size = header[0];
+    std::vector<std::uint64_t> blocks(header[1]);
+    std::size_t offset = sizeof(magic) + sizeof(header);
+    std::size_t const indices_size = blocks.size() * sizeof(std::uint64_t);
+    checked_pio(false, fd.get(), blocks.data(), indices_size, offset, path);
+    offset += indices_size;
+    for (std::uint64_t const ib : blocks) {
+        std::size_t const begin = ib * block_size;
+        if (begin >= size) {
+            throw std::runtime_error(path + ": block out of the chunk");
+        }
+        std::size_t const length = std::min(block_size, size - begin);
+        checked_pio(false, fd.get(), data + begin, length, offset, path);
+        offset += length;
+    }
+}
+
+} // namespace detail
+
+/** Incremental checkpoint of a chunk.
+ *
+ * The first `save` writes the whole chunk in `prefix.base` with `write_chunk`. The next ones
+ * split the data into blocks of `block_size` bytes, hash them in parallel on the given execution
+ * space and only write the blocks that changed since the previous `save` in `prefix.delta.<step>`.
+ * Only the changed blocks are copied from the memory space of the data to the host. The text file
+ * `prefix.manifest` lists the base and the deltas to apply in order by their path relative to the
+ * prefix, see `restore_delta_checkpoint`.
+ *
+ * This is only available on POSIX systems.
+ */
+template <class ElementType, class SupportType>
+class DeltaCheckpoint
+{
+    static_assert(std::is_trivially_copyable_v<ElementType>);
+
+    std::string m_prefix;
+
+    SupportType m_domain;
+
+    std::size_t m_block_size;
+
+    std::vector<std::uint64_t> m_hashes;
+
+    std::size_t m_step = 0;
+
+    /// Write the blocks `changed` of `data` in the delta file `path`, see `detail::apply_delta`
+    template <class ExecSpace, class MemorySpace>
+    void write_delta(
+            ExecSpace const& exec_space,
+            ChunkSpan<ElementType const, SupportType, Kokkos::layout_right, MemorySpace> const&
+                    data,
+            std::vector<std::uint64_t> const& changed,
+            std::string const& path) const
+    {
+        std::size_t const size = m_domain.size() * sizeof(ElementType);
+        ddc::detail::FileDescriptor const
+                fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+        if (fd.get() == -1) {
+            throw ddc::detail::system_error("Cannot create " + path, errno);
+        }
+        std::uint64_t header[2] = {m_block_size, changed.size()};
+        char magic[sizeof(detail::s_delta_magic)];
+        std::memcpy(magic, detail::s_delta_magic, sizeof(magic));
+        detail::checked_pio(true, fd.get(), magic, sizeof(magic), 0, path);
+        std::size_t offset = sizeof(magic);
+        detail::checked_pio(true, fd.get(), header, sizeof(header), offset, path);
+        offset += sizeof(header);
+        std::size_t const indices_size = changed.size() * sizeof(std::uint64_t);
+        detail::checked_pio(
+                true,
+                fd.get(),
+                const_cast<std::uint64_t*>(changed.data()),
+                indices_size,
+                offset,
+                path);
+        offset += indices_size;
+        if (changed.empty()) {
+            return;
+        }
+
+        // Only the changed blocks are copied to the host, gathered on the device if needed
+        DiscreteDomain<detail::DeltaBlock, detail::DeltaByte> const blocks_dom(
+                DiscreteDomain<detail::DeltaBlock>(
+                        create_reference_discrete_element<detail::DeltaBlock>(),
+                        DiscreteVector<detail::DeltaBlock>(changed.size())),
+                DiscreteDomain<detail::DeltaByte>(
+                        create_reference_discrete_element<detail::DeltaByte>(),
+                        DiscreteVector<detail::DeltaByte>(m_block_size)));
+        std::optional<Chunk<
+                unsigned char,
+                DiscreteDomain<detail::DeltaBlock, detail::DeltaByte>,
+                KokkosAllocator<unsigned char, Kokkos::HostSpace>>>
+                blocks_host;
+        if constexpr (!Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible) {
+            ChunkSpan<
+                    std::uint64_t const,
+                    DiscreteDomain<detail::DeltaBlock>,
+                    Kokkos::layout_right,
+                    Kokkos::HostSpace> const
+                    changed_host(changed.data(), DiscreteDomain<detail::DeltaBlock>(blocks_dom));
+            auto const indices = create_mirror_and_copy(MemorySpace(), changed_host);
+            Chunk blocks_alloc(
+                    "ddc_delta_checkpoint_blocks",
+                    blocks_dom,
+                    KokkosAllocator<unsigned char, MemorySpace>());
+            detail::gather_blocks(
+                    exec_space,
+                    blocks_alloc.span_view(),
+                    indices.span_cview(),
+                    reinterpret_cast<unsigned char const*>(data.data_handle()),
+                    size);
+            exec_space.fence("ddc_delta_checkpoint_gather");
+            blocks_host.emplace(create_mirror_and_copy(blocks_alloc.span_cview()));
+        }
+        for (std::size_t j = 0; j < changed.size(); ++j) {
+            std::size_t const begin = changed[j] * m_block_size;
+            std::size_t const length = std::min(m_block_size, size - begin);
+            std::byte const* src = reinterpret_cast<std::byte const*>(data.data_handle()) + begin;
+            if (blocks_host) {
+                src = reinterpret_cast<std::byte const*>(blocks_host->data_handle())
+                      + j * m_block_size;
+            }
+            detail::checked_pio(true, fd.get(), const_cast<std::byte*>(src), length, offset, path);
+            offset += length;
+        }
+    }
+
+public:
+    /// @param block_size the size in bytes of the blocks compared between two saves
+    DeltaCheckpoint(
+            std::string prefix,
+            SupportType const& domain,
+            std::size_t const block_size = std::size_t(1) << 20)
+        : m_prefix(std::move(prefix))
+        , m_domain(domain)
+        , m_block_size(block_size)
+    {
+        if (block_size == 0) {
+            throw std::runtime_error("The block size of a delta checkpoint must be positive");
+        }
+    }
+
+    /// Number of blocks the chunk is split into
+    std::size_t nb_blocks() const noexcept
+    {
+        return (m_domain.size() * sizeof(ElementType) + m_block_size - 1) / m_block_size;
+    }
+
+    /** Save `data`, fully at the first call and then only its blocks that changed
+     * @return the number of blocks written
+     */
+    template <class ExecSpace, class MemorySpace>
+    std::size_t save(
+            ExecSpace const& exec_space,
+            ChunkSpan<ElementType const, SupportType, Kokkos::layout_right, MemorySpace> const&
+                    data)
+    {
+        static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible);
+        if (data.domain() != m_domain) {
+            throw std::runtime_error("The domain does not match the checkpointed one");
+        }
+        std::size_t const size = m_domain.size() * sizeof(ElementType);
+        DiscreteDomain<detail::DeltaBlock> const blocks(
+                create_reference_discrete_element<detail::DeltaBlock>(),
+                DiscreteVector<detail::DeltaBlock>(nb_blocks()));
+        Chunk hashes_alloc(
+                "ddc_delta_checkpoint_hashes",
+                blocks,
+                KokkosAllocator<std::uint64_t, MemorySpace>());
+        detail::hash_blocks(
+                exec_space,
+                hashes_alloc.span_view(),
+                reinterpret_cast<unsigned char const*>(data.data_handle()),
+                size,
+                m_block_size);
+        exec_space.fence("ddc_delta_checkpoint_hash");
+        auto const hashes_host = create_mirror_and_copy(hashes_alloc.span_cview());
+
+        std::vector<std::uint64_t> hashes(
+                hashes_host.span_cview().data_handle(),
+                hashes_host.span_cview().data_handle() + blocks.size());
+        std::vector<std::uint64_t> changed;
+        for (std::size_t i = 0; i < hashes.size(); ++i) {
+            if (m_hashes.empty() || m_hashes[i] != hashes[i]) {
+                changed.push_back(i);
+            }
+        }
+
+        if (m_step == 0) {
+            auto const data_host = create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+            write_chunk(m_prefix + ".base", data_host.span_cview());
+            // The paths are relative to the prefix, which may contain spaces
+            std::ofstream manifest(m_prefix + ".manifest", std::ios::trunc);
+            manifest << "base .base\n";
+            if (!manifest) {
+                throw std::runtime_error("Cannot write " + m_prefix + ".manifest");
+            }
+        } else {
+            std::string const suffix = ".delta." + std::to_string(m_step);
+            write_delta(exec_space, data, changed, m_prefix + suffix);
+            std::ofstream manifest(m_prefix + ".manifest", std::ios::app);
+            manifest << "delta " << suffix << '\n';
+            if (!manifest) {
+                throw std::runtime_error("Cannot write " + m_prefix + ".manifest");
+            }
+        }
+        // Only commit the hashes once the save succeeded so that a failed one is fully redone
+        m_hashes.swap(hashes);
+        ++m_step;
+        return changed.size();
+    }
+};
+
+/// Rebuild in `data` the last state saved by a `DeltaCheckpoint` of the same `prefix`
+template <class ElementType, class SupportType, class MemorySpace>
+void restore_delta_checkpoint(
+        std::string const& prefix,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& data)
+{
+    static_assert(!std::is_const_v<ElementType>, "Cannot restore into a constant chunk");
+    std::ifstream manifest(prefix + ".manifest");
+    if (!manifest) {
+        throw std::runtime_error("Cannot open " + prefix + ".manifest");
+    }
+    auto data_host = create_mirror_view(data);
+    ChunkSpan const data_host_span = data_host.span_view();
+    std::byte* const bytes = reinterpret_cast<std::byte*>(data_host_span.data_handle());
+    std::size_t const size = data_host_span.size() * sizeof(ElementType);
+    std::string kind;
+    std::string suffix;
+    bool has_base = false;
+    while (manifest >> kind >> suffix) {
+        if (kind == "base") {
+            read_chunk(prefix + suffix, data_host_span);
+            has_base = true;
+        } else if (kind == "delta" && has_base) {
+            detail::apply_delta(prefix + suffix, bytes, size);
+        } else {
+            throw std::runtime_error(prefix + ".manifest: invalid entry " + kind + ' ' + suffix);
+        }
+    }
+    if (!has_base) {
+        throw std::runtime_error(prefix + ".manifest: no base checkpoint");
+    }
+    if constexpr (!Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible) {
+        parallel_deepcopy(data, data_host_span);
+    }
+}
+
+} // namespace ddc::io
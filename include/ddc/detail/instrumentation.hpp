@@ -0,0 +1,104 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <Kokkos_Core.hpp>
+
+namespace ddc::detail {
+
+/// Size of the work of an algorithm call, the bytes are an estimate and 0 when unknown
+struct WorkInfo
+{
+    std::size_t elements = 0;
+
+    std::size_t element_size = 0;
+
+    std::size_t bytes_read = 0;
+
+    std::size_t bytes_written = 0;
+};
+
+/// Prefix of the Kokkos Tools events describing the work of the enclosing region
+inline constexpr char const* s_work_event_prefix = "ddc_work";
+
+inline std::string work_event(WorkInfo const& info)
+{
+    return std::string(s_work_event_prefix) + " elements=" + std::to_string(info.elements)
+           + " element_size=" + std::to_string(info.element_size)
+           + " bytes_read=" + std::to_string(info.bytes_read)
+           + " bytes_written=" + std::to_string(info.bytes_written);
+}
+
+/**
+ * The fence at the end of the instrumented regions is enabled by setting the environment variable
+ * `DDC_INSTRUMENTATION_FENCE`
+ */
+inline bool is_instrumentation_fence_enabled()
+{
+    static bool const enabled = [] {
+        char const* const env = std::getenv("DDC_INSTRUMENTATION_FENCE");
+        return env != nullptr && std::string_view(env) != "" && std::string_view(env) != "0";
+    }();
+    return enabled;
+}
+
+/**
+ * Wraps an algorithm call in a Kokkos Tools region named after its label and reports the work
+ * size with an event, see `work_event`.
+ *
+ * Nothing is done when no tool is loaded. The asynchronous work is not waited for at the end of
+ * the region unless `is_instrumentation_fence_enabled`, so that the execution is the same with
+ * and without a tool, the fencing of the kernels being left to the tool.
+ */
+template <class ExecSpace>
+class ScopedInstrumentation
+{
+    /// Only kept to be fenced, to avoid copying the instance when nothing is done
+    std::optional<ExecSpace> m_execution_space;
+
+    bool m_active;
+
+public:
+    ScopedInstrumentation(
+            std::string const& label,
+            ExecSpace const& execution_space,
+            WorkInfo const& info)
+        : m_active(Kokkos::Tools::profileLibraryLoaded())
+    {
+        if (m_active && is_instrumentation_fence_enabled()) {
+            m_execution_space.emplace(execution_space);
+        }
+        if (m_active) {
+            Kokkos::Tools::pushRegion(label);
+            Kokkos::Tools::markEvent(work_event(info));
+        }
+    }
+
+    ScopedInstrumentation(ScopedInstrumentation const& rhs) = delete;
+
+    ScopedInstrumentation(ScopedInstrumentation&& rhs) = delete;
+
+    ~ScopedInstrumentation() noexcept
+    {
+        if (m_execution_space) {
+            m_execution_space->fence("ddc_instrumentation");
+        }
+        if (m_active) {
+            Kokkos::Tools::popRegion();
+        }
+    }
+
+    ScopedInstrumentation& operator=(ScopedInstrumentation const& rhs) = delete;
+
+    ScopedInstrumentation& operator=(ScopedInstrumentation&& rhs) = delete;
+};
+
+} // namespace ddc::detail
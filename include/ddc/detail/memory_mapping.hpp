@@ -0,0 +1,168 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ddc::detail {
+
+inline std::runtime_error system_error(std::string const& what, int const err)
+{
+    return std::runtime_error(what + ": " + std::strerror(err));
+}
+
+/// RAII owner of a POSIX file descriptor
+class FileDescriptor
+{
+    int m_fd = -1;
+
+public:
+    FileDescriptor() = default;
+
+    explicit FileDescriptor(int const fd) noexcept : m_fd(fd) {}
+
+    FileDescriptor(FileDescriptor const& other) = delete;
+
+    FileDescriptor(FileDescriptor&& other) noexcept : m_fd(std::exchange(other.m_fd, -1)) {}
+
+    ~FileDescriptor() noexcept
+    {
+        if (m_fd != -1) {
+            ::close(m_fd);
+        }
+    }
+
+    FileDescriptor& operator=(FileDescriptor const& other) = delete;
+
+    FileDescriptor& operator=(FileDescriptor&& other) noexcept
+    {
+        std::swap(m_fd, other.m_fd);
+        return *this;
+    }
+
+    int get() const noexcept
+    {
+        return m_fd;
+    }
+
+    /// @return the size in bytes of the underlying file
+    std::size_t file_size() const
+    {
+        struct stat st;
+        if (::fstat(m_fd, &st) != 0) {
+            throw system_error("fstat", errno);
+        }
+        return static_cast<std::size_t>(st.st_size);
+    }
+
+    /// Resize the underlying file to `size` bytes
+    void resize(std::size_t const size) const
+    {
+        if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+            throw system_error("ftruncate", errno);
+        }
+    }
+};
+
+/// RAII owner of a shared `mmap` mapping of a file descriptor
+class MemoryMapping
+{
+    void* m_address = nullptr;
+
+    std::size_t m_length = 0;
+
+public:
+    MemoryMapping() = default;
+
+    /** Map the first `length` bytes of `fd`
+     * @param fd an open file descriptor, it may be closed once the mapping is created
+     * @param length the number of bytes to map
+     * @param writable whether the mapping is read-write or read-only
+     */
+    MemoryMapping(int const fd, std::size_t const length, bool const writable) : m_length(length)
+    {
+        if (length == 0) {
+            return;
+        }
+        int const prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* const address = ::mmap(nullptr, length, prot, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            throw system_error("mmap", errno);
+        }
+        m_address = address;
+    }
+
+    MemoryMapping(MemoryMapping const& other) = delete;
+
+    MemoryMapping(MemoryMapping&& other) noexcept
+        : m_address(std::exchange(other.m_address, nullptr))
+        , m_length(std::exchange(other.m_length, 0))
+    {
+    }
+
+    ~MemoryMapping() noexcept
+    {
+        if (m_address) {
+            ::munmap(m_address, m_length);
+        }
+    }
+
+    MemoryMapping& operator=(MemoryMapping const& other) = delete;
+
+    MemoryMapping& operator=(MemoryMapping&& other) noexcept
+    {
+        std::swap(m_address, other.m_address);
+        std::swap(m_length, other.m_length);
+        return *this;
+    }
+
+    std::byte* data() const noexcept
+    {
+        return static_cast<std::byte*>(m_address);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_length;
+    }
+
+    /// Give up the ownership of the mapping, the caller becomes responsible for `munmap`
+    std::byte* release() noexcept
+    {
+        m_length = 0;
+        return static_cast<std::byte*>(std::exchange(m_address, nullptr));
+    }
+
+    /// Give the kernel a `posix_madvise` hint about the access pattern
+    void advise(int const advice) const
+    {
+        if (m_address) {
+            int const err = ::posix_madvise(m_address, m_length, advice);
+            if (err != 0) {
+                throw system_error("posix_madvise", err);
+            }
+        }
+    }
+
+    /// Synchronously write back modified pages to the underlying file
+    void sync() const
+    {
+        if (m_address && ::msync(m_address, m_length, MS_SYNC) != 0) {
+            throw system_error("msync", errno);
+        }
+    }
+};
+
+} // namespace ddc::detail
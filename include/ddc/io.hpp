@@ -0,0 +1,312 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/memory_mapping.hpp"
+
+#include "chunk_span.hpp"
+#include "discrete_domain.hpp"
+#include "mapped_chunk.hpp"
+#include "print.hpp"
+
+namespace ddc::io {
+
+namespace detail {
+
+/// Size of the blocks written or read concurrently, a multiple of the data alignment
+inline constexpr std::size_t s_io_block_size = std::size_t(8) << 20;
+
+/** Description of the content stored after the dimensions in the header of a chunk file.
+ *
+ * It is a 64-bit unsigned length followed by the demangled names of the element type and of
+ * the dimensions, separated by new lines. `MappedChunk::create` leaves it empty.
+ */
+template <class ElementType, class... DDims>
+std::string chunk_description(DiscreteDomain<DDims...> const&)
+{
+    std::ostringstream os;
+    ddc::detail::print_demangled_type_name<std::remove_const_t<ElementType>>(os);
+    ((os << '\n', ddc::detail::print_demangled_type_name<DDims>(os)), ...);
+    return os.str();
+}
+
+struct ChunkFileHeader
+{
+    std::size_t element_size;
+
+    std::size_t data_offset;
+
+    std::vector<std::uint64_t> front;
+
+    std::vector<std::uint64_t> extents;
+
+    std::string description;
+};
+
+/// `pread`/`pwrite` the whole `size` bytes, retrying on partial transfers
+template <bool Write>
+int full_pio(int const fd, std::byte* const data, std::size_t const size, off_t const offset)
+{
+    std::size_t done = 0;
+    while (done < size) {
+        ssize_t const n
+                = Write ? ::pwrite(fd, data + done, size - done, offset + off_t(done))
+                        : ::pread(fd, data + done, size - done, offset + off_t(done));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (n == 0) {
+            return EIO;
+        }
+        done += std::size_t(n);
+    }
+    return 0;
+}
+
+/// Transfers `size` bytes by blocks of `s_io_block_size` from the host execution space threads
+template <bool Write>
+void parallel_pio(int const fd, std::byte* const data, std::size_t const size, off_t const offset)
+{
+    std::size_t const n_blocks = (size + s_io_block_size - 1) / s_io_block_size;
+    int err = 0;
+    Kokkos::parallel_reduce(
+            Write ? "ddc_io_write_blocks" : "ddc_io_read_blocks",
+            Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n_blocks),
+            [=](std::size_t const i, int& block_err) {
+                std::size_t const begin = i * s_io_block_size;
+                std::size_t const length = std::min(s_io_block_size, size - begin);
+                int const e = full_pio<Write>(fd, data + begin, length, offset + off_t(begin));
+                block_err = std::max(block_err, e);
+            },
+            Kokkos::Max<int>(err));
+    if (err != 0) {
+        throw ddc::detail::system_error(Write ? "pwrite" : "pread", err);
+    }
+}
+
+inline ChunkFileHeader read_header(int const fd, std::string const& path, std::size_t const rank)
+{
+    ddc::detail::MappedChunkHeader header;
+    if (full_pio<false>(fd, reinterpret_cast<std::byte*>(&header), sizeof(header), 0) != 0
+        || std::memcmp(
+                   header.magic,
+                   ddc::detail::MappedChunkHeader::s_magic,
+                   sizeof(header.magic))
+                   != 0) {
+        throw std::runtime_error(path + " is not a chunk file");
+    }
+    if (header.version != ddc::detail::MappedChunkHeader::s_version) {
+        throw std::runtime_error(path + ": unsupported chunk file version");
+    }
+    if (header.rank != rank) {
+        throw std::runtime_error(path + ": rank mismatch");
+    }
+
+    std::vector<std::uint64_t> dims(2 * rank + 1);
+    if (full_pio<false>(
+                fd,
+                reinterpret_cast<std::byte*>(dims.data()),
+                dims.size() * sizeof(std::uint64_t),
+                sizeof(header))
+        != 0) {
+        throw std::runtime_error(path + ": truncated chunk file");
+    }
+    ChunkFileHeader out {header.element_size, header.data_offset, {}, {}, {}};
+    for (std::size_t i = 0; i < rank; ++i) {
+        out.front.push_back(dims[2 * i]);
+        out.extents.push_back(dims[2 * i + 1]);
+    }
+    std::size_t const description_offset = sizeof(header) + dims.size() * sizeof(std::uint64_t);
+    std::size_t const description_size = dims.back();
+    if (description_offset + description_size > header.data_offset) {
+        throw std::runtime_error(path + ": corrupted chunk file header");
+    }
+    out.description.resize(description_size);
+    if (full_pio<false>(
+                fd,
+                reinterpret_cast<std::byte*>(out.description.data()),
+                description_size,
+                off_t(description_offset))
+        != 0) {
+        throw std::runtime_error(path + ": truncated chunk file");
+    }
+    return out;
+}
+
+template <class ElementType, class SupportType>
+SupportType checked_domain(ChunkFileHeader const& header, std::string const& path)
+{
+    if (header.element_size != sizeof(ElementType)) {
+        throw std::runtime_error(path + ": element size mismatch");
+    }
+    typename SupportType::discrete_element_type front;
+    typename SupportType::discrete_vector_type extents;
+    for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+        ddc::detail::array(front)[i] = header.front[i];
+        ddc::detail::array(extents)[i] = header.extents[i];
+    }
+    SupportType const domain(front, extents);
+    // Files created by `MappedChunk::create` carry no description
+    if (!header.description.empty()
+        && header.description != chunk_description<ElementType>(domain)) {
+        throw std::runtime_error(
+                path + ": element type or dimensions mismatch, the file contains\n"
+                + header.description);
+    }
+    return domain;
+}
+
+} // namespace detail
+
+/** Write a chunk in a self-describing binary file.
+ *
+ * The file is readable by `read_chunk`, `map_chunk` and `MappedChunk::open`. The header stores
+ * the element type and dimension names, the domain front and extents; it is followed by the raw
+ * data, aligned on a page boundary and written by blocks from the host execution space threads.
+ *
+ * This is only available on POSIX systems.
+ */
+template <class ElementType, class SupportType, class MemorySpace>
+void write_chunk(
+        std::string const& path,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& data)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemorySpace>::accessible,
+            "The chunk must be accessible from the host");
+    static_assert(std::is_trivially_copyable_v<std::remove_const_t<ElementType>>);
+    std::string const description = detail::chunk_description<ElementType>(data.domain());
+    std::size_t const rank = SupportType::rank();
+    std::size_t const header_size = sizeof(ddc::detail::MappedChunkHeader)
+                                    + (2 * rank + 1) * sizeof(std::uint64_t) + description.size();
+    std::size_t const alignment = ddc::detail::MappedChunkHeader::s_data_alignment;
+    std::size_t const data_offset = (header_size + alignment - 1) / alignment * alignment;
+    std::size_t const data_size = data.size() * sizeof(ElementType);
+
+    ddc::detail::MappedChunkHeader header;
+    std::memcpy(header.magic, ddc::detail::MappedChunkHeader::s_magic, sizeof(header.magic));
+    header.version = ddc::detail::MappedChunkHeader::s_version;
+    header.rank = rank;
+    header.element_size = sizeof(ElementType);
+    header.data_offset = data_offset;
+    std::vector<std::byte> buffer(data_offset);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::vector<std::uint64_t> dims;
+    for (std::size_t i = 0; i < rank; ++i) {
+        dims.push_back(ddc::detail::array(data.domain().front())[i]);
+        dims.push_back(ddc::detail::array(data.domain().extents())[i]);
+    }
+    dims.push_back(description.size());
+    std::memcpy(buffer.data() + sizeof(header), dims.data(), dims.size() * sizeof(std::uint64_t));
+    std::memcpy(
+            buffer.data() + sizeof(header) + dims.size() * sizeof(std::uint64_t),
+            description.data(),
+            description.size());
+
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot create " + path, errno);
+    }
+    fd.resize(data_offset + data_size);
+    int const err = detail::full_pio<true>(fd.get(), buffer.data(), buffer.size(), 0);
+    if (err != 0) {
+        throw ddc::detail::system_error("Cannot write " + path, err);
+    }
+    detail::parallel_pio<true>(
+            fd.get(),
+            reinterpret_cast<std::byte*>(const_cast<std::remove_const_t<ElementType>*>(
+                    data.data_handle())),
+            data_size,
+            off_t(data_offset));
+}
+
+/// Read the domain stored in a chunk file, e.g. to allocate the chunk given to `read_chunk`
+template <class SupportType>
+SupportType read_domain(std::string const& path)
+{
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_RDONLY));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot open " + path, errno);
+    }
+    detail::ChunkFileHeader const header = detail::read_header(fd.get(), path, SupportType::rank());
+    typename SupportType::discrete_element_type front;
+    typename SupportType::discrete_vector_type extents;
+    for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+        ddc::detail::array(front)[i] = header.front[i];
+        ddc::detail::array(extents)[i] = header.extents[i];
+    }
+    return SupportType(front, extents);
+}
+
+/** Read a chunk file written by `write_chunk` into `data`, whose domain must match the stored one
+ *
+ * The data is read by blocks from the host execution space threads.
+ */
+template <class ElementType, class SupportType, class MemorySpace>
+void read_chunk(
+        std::string const& path,
+        ChunkSpan<ElementType, SupportType, Kokkos::layout_right, MemorySpace> const& data)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<Kokkos::DefaultHostExecutionSpace, MemorySpace>::accessible,
+            "The chunk must be accessible from the host");
+    static_assert(!std::is_const_v<ElementType>, "Cannot read into a constant chunk");
+    ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_RDONLY));
+    if (fd.get() == -1) {
+        throw ddc::detail::system_error("Cannot open " + path, errno);
+    }
+    detail::ChunkFileHeader const header = detail::read_header(fd.get(), path, SupportType::rank());
+    if (detail::checked_domain<ElementType, SupportType>(header, path) != data.domain()) {
+        throw std::runtime_error(path + ": domain mismatch");
+    }
+    std::size_t const data_size = data.size() * sizeof(ElementType);
+    if (fd.file_size() < header.data_offset + data_size) {
+        throw std::runtime_error(path + ": truncated chunk file");
+    }
+    detail::parallel_pio<false>(
+            fd.get(),
+            reinterpret_cast<std::byte*>(data.data_handle()),
+            data_size,
+            off_t(header.data_offset));
+}
+
+/** Map a chunk file written by `write_chunk` without copy, after checking its description
+ *
+ * The pages are loaded lazily, see `MappedChunk`.
+ */
+template <class ElementType, class SupportType>
+MappedChunk<ElementType, SupportType> map_chunk(
+        std::string const& path,
+        MappedChunkAdvice const advice = MappedChunkAdvice::NORMAL)
+{
+    {
+        ddc::detail::FileDescriptor const fd(::open(path.c_str(), O_RDONLY));
+        if (fd.get() == -1) {
+            throw ddc::detail::system_error("Cannot open " + path, errno);
+        }
+        detail::checked_domain<ElementType, SupportType>(
+                detail::read_header(fd.get(), path, SupportType::rank()),
+                path);
+    }
+    return MappedChunk<ElementType, SupportType>::open(path, advice);
+}
+
+} // namespace ddc::io
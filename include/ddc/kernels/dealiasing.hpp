@@ -0,0 +1,498 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "fft.hpp"
+
+namespace ddc::detail::fft {
+
+template <typename DDimX, typename DDimFx>
+Real normalization_coef_1d(
+        FFT_Direction const direction,
+        FFT_Normalization const normalization,
+        DiscreteDomain<DDimX> const& ddom)
+{
+    if constexpr (std::is_same_v<DDimX, DDimFx>) {
+        // batch dimension
+        return 1;
+    } else {
+        Real const n = ddom.size();
+        switch (normalization) {
+        case ddc::FFT_Normalization::OFF:
+            return 1;
+        case ddc::FFT_Normalization::FORWARD:
+            return direction == ddc::FFT_Direction::FORWARD ? 1 / n : 1;
+        case ddc::FFT_Normalization::BACKWARD:
+            return direction == ddc::FFT_Direction::BACKWARD ? 1 / n : 1;
+        case ddc::FFT_Normalization::ORTHO:
+            return 1 / Kokkos::sqrt(n);
+        case ddc::FFT_Normalization::FULL:
+            return full_norm_coef_1d<DDimX, DDimFx>(direction, ddom);
+        }
+        throw std::runtime_error("ddc::FFT_Normalization not handled");
+    }
+}
+
+/// @brief Product of the normalization coefficients of the transformed dimensions of the mesh.
+template <typename... DDimX, typename... DDimFx>
+Real normalization_coef(
+        FFT_Direction const direction,
+        FFT_Normalization const normalization,
+        DiscreteDomain<DDimX...> const& x_mesh,
+        DiscreteDomain<DDimFx...> const&)
+{
+    return (normalization_coef_1d<DDimX, DDimFx>(
+                    direction,
+                    normalization,
+                    DiscreteDomain<DDimX>(x_mesh))
+            * ...);
+}
+
+/**
+ * @brief Position in the padded spectral mesh of a mode of the spectral mesh, along one dimension.
+ *
+ * The positive frequencies are stored at the beginning and the negative ones at the end. Along
+ * the halved dimension of a R2C transform only the positive frequencies are stored.
+ */
+KOKKOS_FUNCTION inline DiscreteVectorElement padded_mode_position(
+        DiscreteVectorElement const i,
+        DiscreteVectorElement const n,
+        DiscreteVectorElement const m,
+        bool const halved) noexcept
+{
+    return halved || i < (n + 1) / 2 ? i : i - n + m;
+}
+
+/**
+ * @brief Whether each dimension of the mesh is transformed and has a Nyquist mode, ie. an even
+ * number of points.
+ */
+template <typename... DDimX, typename... DDimFx>
+std::array<bool, sizeof...(DDimX)> nyquist_axes(
+        DiscreteDomain<DDimX...> const& x_mesh,
+        DiscreteDomain<DDimFx...> const&)
+{
+    return {(!std::is_same_v<DDimX, DDimFx> && DiscreteDomain<DDimX>(x_mesh).size() % 2 == 0)...};
+}
+
+/**
+ * @brief Copy `in` into `out`, zero-filling the modes of `out` absent from `in` and scaling the
+ * others by `coef`.
+ *
+ * The Nyquist mode -n/2 of `in` is also the mode +n/2, it is split in half between both modes of
+ * `out` so that the padded spectrum of real data stays the one of real data. Along the halved
+ * dimension of a R2C transform the -n/2 mode is implicit, the +n/2 one is thus halved.
+ *
+ * @param halved_axis The position of the halved dimension of a R2C transform, or the rank for C2C.
+ * @param nyquist Whether each dimension of `in` has a Nyquist mode, `out` must then be larger.
+ */
+template <
+        typename ExecSpace,
+        typename T,
+        typename Tin,
+        typename DDomOut,
+        typename DDomIn,
+        typename MemorySpace>
+void pad_spectrum(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+        ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+        std::size_t const halved_axis,
+        std::array<bool, DDomIn::rank()> const& nyquist,
+        real_type_t<T> const coef)
+{
+    constexpr std::size_t rank = DDomIn::rank();
+    typename DDomOut::discrete_element_type const out_front = out.domain().front();
+    typename DDomIn::discrete_element_type const in_front = in.domain().front();
+    std::array<DiscreteVectorElement, rank> const n = detail::array(in.domain().extents());
+    std::array<DiscreteVectorElement, rank> const m = detail::array(out.domain().extents());
+    ddc::parallel_for_each(
+            "ddc_fft_pad_spectrum",
+            exec_space,
+            out.domain(),
+            KOKKOS_LAMBDA(typename DDomOut::discrete_element_type const ip) {
+                std::array<DiscreteVectorElement, rank> const ip_pos
+                        = detail::array(ip - out_front);
+                typename DDomIn::discrete_vector_type i_pos;
+                bool kept = true;
+                real_type_t<T> split = 1;
+                for (std::size_t d = 0; d < rank; ++d) {
+                    DiscreteVectorElement const nd = n[d];
+                    DiscreteVectorElement const md = m[d];
+                    DiscreteVectorElement const p = ip_pos[d];
+                    DiscreteVectorElement const nyquist_pos = d == halved_axis ? nd - 1 : nd / 2;
+                    if (nyquist[d]
+                        && (p == nyquist_pos || (d != halved_axis && p == md - nd / 2))) {
+                        detail::array(i_pos)[d] = nyquist_pos;
+                        split /= 2;
+                    } else if (d == halved_axis || p < (nd + 1) / 2) {
+                        kept = kept && p < nd;
+                        detail::array(i_pos)[d] = p;
+                    } else if (p >= md - nd / 2) {
+                        detail::array(i_pos)[d] = p - md + nd;
+                    } else {
+                        kept = false;
+                    }
+                }
+                out(ip) = kept ? T(in(in_front + i_pos)) * (coef * split) : T(0);
+            });
+}
+
+/**
+ * @brief Copy into `out` the modes of `in` it contains, scaled by `coef`.
+ *
+ * The Nyquist mode of `out` gathers the modes +n/2 and -n/2 of `in`, as pad_spectrum splits it.
+ * Along the halved dimension of a R2C transform the -n/2 mode is the conjugate of the +n/2 one
+ * mirrored along the other transformed dimensions.
+ *
+ * @param halved_axis The position of the halved dimension of a R2C transform, or the rank for C2C.
+ * @param transformed Whether each dimension is transformed, or is a batch dimension.
+ * @param nyquist Whether each dimension of `out` has a Nyquist mode, `in` must then be larger.
+ */
+template <
+        typename ExecSpace,
+        typename T,
+        typename Tin,
+        typename DDomOut,
+        typename DDomIn,
+        typename MemorySpace>
+void truncate_spectrum(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+        ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+        std::size_t const halved_axis,
+        std::array<bool, DDomOut::rank()> const& transformed,
+        std::array<bool, DDomOut::rank()> const& nyquist,
+        real_type_t<T> const coef)
+{
+    constexpr std::size_t rank = DDomOut::rank();
+    typename DDomOut::discrete_element_type const out_front = out.domain().front();
+    typename DDomIn::discrete_element_type const in_front = in.domain().front();
+    std::array<DiscreteVectorElement, rank> const n = detail::array(out.domain().extents());
+    std::array<DiscreteVectorElement, rank> const m = detail::array(in.domain().extents());
+    ddc::parallel_for_each(
+            "ddc_fft_truncate_spectrum",
+            exec_space,
+            out.domain(),
+            KOKKOS_LAMBDA(typename DDomOut::discrete_element_type const i) {
+                std::array<DiscreteVectorElement, rank> const i_pos
+                        = detail::array(i - out_front);
+                // Dimensions along which `i` is a Nyquist mode, gathered from two modes of `in`
+                unsigned nyquist_mask = 0;
+                for (std::size_t d = 0; d < rank; ++d) {
+                    if (nyquist[d] && i_pos[d] == (d == halved_axis ? n[d] - 1 : n[d] / 2)) {
+                        nyquist_mask |= 1U << d;
+                    }
+                }
+                T value(0);
+                for (unsigned negative = 0; negative < (1U << rank); ++negative) {
+                    if ((negative & ~nyquist_mask) != 0) {
+                        continue;
+                    }
+                    typename DDomIn::discrete_vector_type ip_pos;
+                    for (std::size_t d = 0; d < rank; ++d) {
+                        if (d != halved_axis && ((negative >> d) & 1U) != 0) {
+                            detail::array(ip_pos)[d] = m[d] - n[d] / 2;
+                        } else if (d != halved_axis && ((nyquist_mask >> d) & 1U) != 0) {
+                            detail::array(ip_pos)[d] = n[d] / 2;
+                        } else {
+                            detail::array(ip_pos)[d] = padded_mode_position(
+                                    i_pos[d],
+                                    n[d],
+                                    m[d],
+                                    d == halved_axis);
+                        }
+                    }
+                    if (halved_axis < rank && ((negative >> halved_axis) & 1U) != 0) {
+                        for (std::size_t d = 0; d < rank; ++d) {
+                            if (transformed[d] && d != halved_axis) {
+                                detail::array(ip_pos)[d]
+                                        = (m[d] - detail::array(ip_pos)[d]) % m[d];
+                            }
+                        }
+                        value += Kokkos::conj(in(in_front + ip_pos));
+                    } else {
+                        value += in(in_front + ip_pos);
+                    }
+                }
+                out(i) = value * coef;
+            });
+}
+
+template <typename DDimXp, typename DDimX, typename... DDim>
+DiscreteDomain<DDimXp> dealiased_mesh_1d(DiscreteDomain<DDim...> const& x_mesh)
+{
+    if constexpr (std::is_same_v<DDimX, DDimXp>) {
+        // batch dimension
+        return DiscreteDomain<DDimX>(x_mesh);
+    } else {
+        DiscreteVectorElement const n = get<DDimX>(x_mesh.extents());
+        return DiscreteDomain<DDimXp>(
+                DiscreteElement<DDimXp>(0),
+                DiscreteVector<DDimXp>((3 * n + 1) / 2));
+    }
+}
+
+} // namespace ddc::detail::fft
+
+namespace ddc {
+
+/**
+ * @brief Initialize the dealiased discrete dimension of a (1D) mesh, following the 3/2 rule.
+ *
+ * The dealiased mesh spans the same periodic box as `x_mesh` with M = ceil(3N/2) points instead
+ * of N. Its first point is the first point of `x_mesh`.
+ *
+ * @tparam DDimXp A UniformPointSampling representing the dealiased discrete dimension.
+ * @tparam DDimX The type of the original discrete dimension.
+ *
+ * @param x_mesh The DiscreteDomain representing the (1D) original mesh.
+ *
+ * @return The initialized Impl representing the dealiased discrete space.
+ *
+ * @see dealiased_mesh
+ */
+template <typename DDimXp, typename DDimX>
+typename DDimXp::template Impl<DDimXp, Kokkos::HostSpace> init_dealiased_space(
+        ddc::DiscreteDomain<DDimX> x_mesh)
+{
+    static_assert(
+            is_uniform_point_sampling_v<DDimX>,
+            "DDimX dimension must derive from UniformPointSampling");
+    static_assert(
+            is_uniform_point_sampling_v<DDimXp>,
+            "DDimXp dimension must derive from UniformPointSampling");
+    using CDim = typename DDimX::continuous_dimension_type;
+    static_assert(
+            std::is_same_v<typename DDimXp::continuous_dimension_type, CDim>,
+            "DDimX and DDimXp dimensions must be defined over the same continuous dimension");
+
+    DiscreteVectorElement const n = get<DDimX>(x_mesh.extents());
+    ddc::DiscreteDomain<DDimXp> const xp_mesh
+            = detail::fft::dealiased_mesh_1d<DDimXp, DDimX>(x_mesh);
+    // The period of the box is N*dx
+    Real const period = n * ddc::step<DDimX>();
+    return typename DDimXp::template Impl<DDimXp, Kokkos::HostSpace>(
+            ddc::coordinate(x_mesh.front()),
+            period / xp_mesh.size());
+}
+
+/**
+ * @brief Get the dealiased mesh.
+ *
+ * A DDimXp identical to the DDimX at the same position denotes a batch dimension, which is kept
+ * as is in the dealiased mesh.
+ *
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ *
+ * @return The domain representing the dealiased mesh.
+ *
+ * @see init_dealiased_space
+ */
+template <typename... DDimXp, typename... DDimX>
+ddc::DiscreteDomain<DDimXp...> dealiased_mesh(ddc::DiscreteDomain<DDimX...> x_mesh)
+{
+    return ddc::DiscreteDomain<DDimXp...>(
+            detail::fft::dealiased_mesh_1d<DDimXp, DDimX>(x_mesh)...);
+}
+
+/**
+ * @brief Perform an inverse Fast Fourier Transform on the dealiased mesh.
+ *
+ * The spectrum `in`, defined on the Fourier mesh of `x_mesh`, is zero-padded to the Fourier mesh
+ * of the dealiased mesh directly into the memory of `out`, and transformed in place. No padded
+ * spectral chunk is allocated. The normalization is the one of an iFFT on `x_mesh`, so that the
+ * result samples on the dealiased mesh the same function as ifft(in) does on `x_mesh`.
+ *
+ * - For C2C transforms, `out` is defined on `dealiased_mesh<DDimXp...>(x_mesh)`.
+ * - For C2R transforms, `out` is defined on `padded_real_mesh<DDimFxp...>(xp_mesh)` where `xp_mesh`
+ *   is the dealiased mesh, the meaningful values are those on `xp_mesh`.
+ *
+ * @tparam DDimFxp... The parameter pack of the Fourier discrete dimensions of the dealiased mesh.
+ * @tparam T The type of the output elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
+ * @tparam DDimXp... The parameter pack of the dealiased discrete dimensions.
+ * @tparam Tin The type of the input elements (Kokkos::complex<float> or Kokkos::complex<double>).
+ * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions.
+ * @tparam DDimX... The parameter pack of the original discrete dimensions.
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the iFFT is performed.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which are stored the discrete functions.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the iFFT is performed.
+ * @param out The output discrete function, overwritten.
+ * @param in The spectral discrete function to transform, it is preserved.
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ * @param kwargs The kwArgs_fft configuring the iFFT.
+ *
+ * @see fft_truncated, dealiased_mesh
+ */
+template <
+        typename... DDimFxp,
+        typename T,
+        typename... DDimXp,
+        typename Tin,
+        typename... DDimFx,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace>
+void ifft_padded(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, ddc::DiscreteDomain<DDimXp...>, Kokkos::layout_right, MemorySpace> const&
+                out,
+        ddc::ChunkSpan<
+                Tin,
+                ddc::DiscreteDomain<DDimFx...>,
+                Kokkos::layout_right,
+                MemorySpace> const& in,
+        ddc::DiscreteDomain<DDimX...> const& x_mesh,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(detail::fft::is_complex_v<std::remove_const_t<Tin>>, "Input must be complex");
+    using Tk = Kokkos::complex<detail::fft::real_type_t<T>>;
+    using transformed_axes_type = detail::fft::
+            TransformedAxes<ddc::DiscreteDomain<DDimX...>, ddc::DiscreteDomain<DDimFx...>>;
+    constexpr bool c2c = detail::fft::is_complex_v<T>;
+
+    ddc::DiscreteDomain<DDimXp...> const xp_mesh = dealiased_mesh<DDimXp...>(x_mesh);
+    ddc::DiscreteDomain<DDimFxp...> const kp_mesh = fourier_mesh<DDimFxp...>(xp_mesh, c2c);
+    assert(in.domain() == fourier_mesh<DDimFx...>(x_mesh, c2c));
+    assert(out.domain() == (c2c ? xp_mesh : padded_real_mesh<DDimFxp...>(xp_mesh)));
+    ddc::ChunkSpan<Tk, ddc::DiscreteDomain<DDimFxp...>, Kokkos::layout_right, MemorySpace> const
+            out_k(reinterpret_cast<Tk*>(out.data_handle()), kp_mesh);
+
+    // The whole normalization of the iFFT on x_mesh is folded in the padding
+    detail::fft::pad_spectrum(
+            exec_space,
+            out_k,
+            in,
+            c2c ? sizeof...(DDimX) : transformed_axes_type::axes().back(),
+            detail::fft::nyquist_axes(x_mesh, in.domain()),
+            static_cast<detail::fft::real_type_t<T>>(detail::fft::normalization_coef(
+                    ddc::FFT_Direction::BACKWARD,
+                    kwargs.normalization,
+                    x_mesh,
+                    in.domain())));
+    FFTPlan<ExecSpace,
+            Tk,
+            T,
+            ddc::DiscreteDomain<DDimFxp...>,
+            ddc::DiscreteDomain<DDimXp...>,
+            MemorySpace> const
+            plan(exec_space,
+                 out,
+                 out_k,
+                 ddc::FFT_Direction::BACKWARD,
+                 {ddc::FFT_Normalization::OFF},
+                 detail::fft::transformed_shape(xp_mesh, kp_mesh));
+    plan(out, out_k);
+}
+
+/**
+ * @brief Perform a direct Fast Fourier Transform on the dealiased mesh, truncated to the Fourier
+ * mesh of the original mesh.
+ *
+ * `inout` is transformed in place and the modes of the Fourier mesh of `x_mesh` are copied from
+ * its memory to `out`, the others are discarded. No padded spectral chunk is allocated. The
+ * normalization is the one of a FFT on `x_mesh`, so that fft_truncated and ifft_padded are inverse
+ * of each other as are fft and ifft.
+ *
+ * - For C2C transforms, `inout` is defined on `dealiased_mesh<DDimXp...>(x_mesh)`.
+ * - For R2C transforms, `inout` is defined on `padded_real_mesh<DDimFxp...>(xp_mesh)` where
+ *   `xp_mesh` is the dealiased mesh, and the real values to transform are those on `xp_mesh`.
+ *
+ * @tparam DDimFxp... The parameter pack of the Fourier discrete dimensions of the dealiased mesh.
+ * @tparam Tout The type of the output elements (Kokkos::complex<float> or Kokkos::complex<double>).
+ * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions.
+ * @tparam T The type of the input elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
+ * @tparam DDimXp... The parameter pack of the dealiased discrete dimensions.
+ * @tparam DDimX... The parameter pack of the original discrete dimensions.
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the FFT is performed.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which are stored the discrete functions.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the FFT is performed.
+ * @param out The output spectral discrete function, defined on the Fourier mesh of `x_mesh`.
+ * @param inout The discrete function to transform, overwritten by its padded spectrum.
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ * @param kwargs The kwArgs_fft configuring the FFT.
+ *
+ * @see ifft_padded, dealiased_mesh
+ */
+template <
+        typename... DDimFxp,
+        typename Tout,
+        typename... DDimFx,
+        typename T,
+        typename... DDimXp,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace>
+void fft_truncated(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<
+                Tout,
+                ddc::DiscreteDomain<DDimFx...>,
+                Kokkos::layout_right,
+                MemorySpace> const& out,
+        ddc::ChunkSpan<T, ddc::DiscreteDomain<DDimXp...>, Kokkos::layout_right, MemorySpace> const&
+                inout,
+        ddc::DiscreteDomain<DDimX...> const& x_mesh,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(detail::fft::is_complex_v<Tout>, "Output must be complex");
+    using Tk = Kokkos::complex<detail::fft::real_type_t<T>>;
+    using transformed_axes_type = detail::fft::
+            TransformedAxes<ddc::DiscreteDomain<DDimX...>, ddc::DiscreteDomain<DDimFx...>>;
+    constexpr bool c2c = detail::fft::is_complex_v<T>;
+
+    ddc::DiscreteDomain<DDimXp...> const xp_mesh = dealiased_mesh<DDimXp...>(x_mesh);
+    ddc::DiscreteDomain<DDimFxp...> const kp_mesh = fourier_mesh<DDimFxp...>(xp_mesh, c2c);
+    assert(out.domain() == fourier_mesh<DDimFx...>(x_mesh, c2c));
+    assert(inout.domain() == (c2c ? xp_mesh : padded_real_mesh<DDimFxp...>(xp_mesh)));
+    ddc::ChunkSpan<Tk, ddc::DiscreteDomain<DDimFxp...>, Kokkos::layout_right, MemorySpace> const
+            inout_k(reinterpret_cast<Tk*>(inout.data_handle()), kp_mesh);
+
+    FFTPlan<ExecSpace,
+            T,
+            Tk,
+            ddc::DiscreteDomain<DDimXp...>,
+            ddc::DiscreteDomain<DDimFxp...>,
+            MemorySpace> const
+            plan(exec_space,
+                 inout_k,
+                 inout,
+                 ddc::FFT_Direction::FORWARD,
+                 {ddc::FFT_Normalization::OFF},
+                 detail::fft::transformed_shape(xp_mesh, kp_mesh));
+    plan(inout_k, inout);
+    // The sums over the dealiased mesh are brought back to sums over x_mesh, and the whole
+    // normalization of the FFT on x_mesh is folded in the truncation
+    Real const size_ratio = static_cast<Real>(detail::fft::transformed_size(x_mesh, out.domain()))
+                            / detail::fft::transformed_size(xp_mesh, kp_mesh);
+    detail::fft::truncate_spectrum(
+            exec_space,
+            out,
+            inout_k,
+            c2c ? sizeof...(DDimX) : transformed_axes_type::axes().back(),
+            {!std::is_same_v<DDimX, DDimFx>...},
+            detail::fft::nyquist_axes(x_mesh, out.domain()),
+            static_cast<detail::fft::real_type_t<Tout>>(
+                    size_ratio
+                    * detail::fft::normalization_coef(
+                            ddc::FFT_Direction::FORWARD,
+                            kwargs.normalization,
+                            x_mesh,
+                            out.domain())));
+}
+
+} // namespace ddc
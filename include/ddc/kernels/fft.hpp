@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -50,6 +54,17 @@ enum class FFT_Normalization {
           */
 };
 
+/**
+ * @brief A structure embedding the configuration of the exposed FFT function with the type of normalization.
+ *
+ * @see fft, ifft
+ */
+struct kwArgs_fft
+{
+    ddc::FFT_Normalization
+            normalization; ///< Enum member to identify the type of normalization performed
+};
+
 } // namespace ddc
 
 namespace ddc::detail::fft {
@@ -95,12 +110,42 @@ struct kwArgs_impl
     ddc::FFT_Normalization normalization;
 };
 
-template <typename... DDimX>
-KokkosFFT::axis_type<sizeof...(DDimX)> axes()
+/**
+ * @brief The dimensions transformed by a FFT from DDomIn to DDomOut.
+ *
+ * A dimension is transformed when the input and output dimensions at the same position differ,
+ * otherwise it is a batch dimension.
+ */
+template <typename DDomIn, typename DDomOut>
+struct TransformedAxes;
+
+template <typename... DDimIn, typename... DDimOut>
+struct TransformedAxes<DiscreteDomain<DDimIn...>, DiscreteDomain<DDimOut...>>
 {
-    return KokkosFFT::axis_type<sizeof...(DDimX)> {
-            static_cast<int>(ddc::type_seq_rank_v<DDimX, ddc::detail::TypeSeq<DDimX...>>)...};
-}
+    static_assert(
+            sizeof...(DDimIn) == sizeof...(DDimOut),
+            "Input and output must have the same rank");
+
+    static constexpr std::size_t size = ((std::is_same_v<DDimIn, DDimOut> ? 0 : 1) + ... + 0);
+
+    static_assert(size > 0, "At least one dimension must be transformed");
+
+    /// @return The positions of the transformed dimensions, in increasing order.
+    static constexpr KokkosFFT::axis_type<size> axes() noexcept
+    {
+        std::array<bool, sizeof...(DDimIn)> const is_transformed {
+                !std::is_same_v<DDimIn, DDimOut>...};
+        KokkosFFT::axis_type<size> axes {};
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < is_transformed.size(); ++i) {
+            if (is_transformed[i]) {
+                axes[j] = static_cast<int>(i);
+                ++j;
+            }
+        }
+        return axes;
+    }
+};
 
 inline KokkosFFT::Normalization ddc_fft_normalization_to_kokkos_fft(
         FFT_Normalization const ddc_fft_normalization)
@@ -159,95 +204,341 @@ Real backward_full_norm_coef(DiscreteDomain<DDim> const& ddom) noexcept
     return 1 / (forward_full_norm_coef(ddom) * ddom.extents().value());
 }
 
-/// @brief Core internal function to perform the FFT.
+inline KokkosFFT::Direction ddc_fft_direction_to_kokkos_fft(FFT_Direction const ddc_fft_direction)
+{
+    if (ddc_fft_direction == ddc::FFT_Direction::FORWARD) {
+        return KokkosFFT::Direction::forward;
+    }
+
+    if (ddc_fft_direction == ddc::FFT_Direction::BACKWARD) {
+        return KokkosFFT::Direction::backward;
+    }
+
+    throw std::runtime_error("ddc::FFT_Direction not handled");
+}
+
+template <typename DDimX, typename DDimFx>
+Real full_norm_coef_1d(FFT_Direction const direction, DiscreteDomain<DDimX> const& ddom)
+{
+    if constexpr (std::is_same_v<DDimX, DDimFx>) {
+        // batch dimension
+        return 1;
+    } else if (direction == ddc::FFT_Direction::FORWARD) {
+        return forward_full_norm_coef(ddom);
+    } else {
+        return backward_full_norm_coef(ddom);
+    }
+}
+
+/// @brief Product of the FULL normalization coefficients of the transformed dimensions of the mesh.
+template <typename... DDimX, typename... DDimFx>
+Real full_norm_coef(
+        FFT_Direction const direction,
+        DiscreteDomain<DDimX...> const& x_mesh,
+        DiscreteDomain<DDimFx...> const&)
+{
+    return (full_norm_coef_1d<DDimX, DDimFx>(direction, DiscreteDomain<DDimX>(x_mesh)) * ...);
+}
+
+} // namespace ddc::detail::fft
+
+namespace ddc {
+
+/**
+ * @brief A reusable plan for the Fast Fourier Transforms performed by fft and ifft.
+ *
+ * The plan of the FFT backend (ie. fftw, cuFFT...) and the normalization coefficients are
+ * computed once at construction. Executing the plan many times on discrete functions defined on
+ * the same domains thus only costs the transform itself.
+ *
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the FFT is performed.
+ * @tparam Tin The type of the input elements.
+ * @tparam Tout The type of the output elements.
+ * @tparam DDomIn The type of the input DiscreteDomain.
+ * @tparam DDomOut The type of the output DiscreteDomain.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which are stored the input and output discrete functions.
+ *
+ * @see fft, ifft
+ */
 template <
+        typename ExecSpace,
         typename Tin,
         typename Tout,
-        typename ExecSpace,
-        typename MemorySpace,
-        typename LayoutIn,
-        typename LayoutOut,
-        typename... DDimIn,
-        typename... DDimOut>
-void impl(
-        ExecSpace const& exec_space,
-        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimIn...>, LayoutIn, MemorySpace> const& in,
-        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimOut...>, LayoutOut, MemorySpace> const& out,
-        kwArgs_impl const& kwargs)
+        typename DDomIn,
+        typename DDomOut,
+        typename MemorySpace>
+class FFTPlan
 {
     static_assert(
-            std::is_same_v<real_type_t<Tin>, float> || std::is_same_v<real_type_t<Tin>, double>,
+            std::is_same_v<detail::fft::real_type_t<Tin>, float>
+                    || std::is_same_v<detail::fft::real_type_t<Tin>, double>,
             "Base type of Tin (and Tout) must be float or double.");
     static_assert(
-            std::is_same_v<real_type_t<Tin>, real_type_t<Tout>>,
+            std::is_same_v<detail::fft::real_type_t<Tin>, detail::fft::real_type_t<Tout>>,
             "Types Tin and Tout must be based on same type (float or double)");
     static_assert(
             Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
             "MemorySpace has to be accessible for ExecutionSpace.");
 
-    Kokkos::View<
-            ddc::detail::mdspan_to_kokkos_element_t<Tin, sizeof...(DDimIn)>,
-            ddc::detail::mdspan_to_kokkos_layout_t<LayoutIn>,
-            MemorySpace> const in_view
-            = in.allocation_kokkos_view();
-    Kokkos::View<
-            ddc::detail::mdspan_to_kokkos_element_t<Tout, sizeof...(DDimIn)>,
-            ddc::detail::mdspan_to_kokkos_layout_t<LayoutOut>,
-            MemorySpace> const out_view
-            = out.allocation_kokkos_view();
-    KokkosFFT::Normalization const kokkos_fft_normalization
-            = ddc_fft_normalization_to_kokkos_fft(kwargs.normalization);
-
-    // C2C
-    if constexpr (std::is_same_v<Tin, Tout>) {
-        if (kwargs.direction == ddc::FFT_Direction::FORWARD) {
-            KokkosFFT::
-                    fftn(exec_space,
-                         in_view,
-                         out_view,
-                         axes<DDimIn...>(),
-                         kokkos_fft_normalization);
-        } else {
-            KokkosFFT::
-                    ifftn(exec_space,
-                          in_view,
-                          out_view,
-                          axes<DDimIn...>(),
-                          kokkos_fft_normalization);
+    using transformed_axes_type = detail::fft::TransformedAxes<DDomIn, DDomOut>;
+
+    static constexpr std::size_t s_rank = DDomIn::rank();
+
+    using in_view_type = Kokkos::View<
+            detail::mdspan_to_kokkos_element_t<Tin, s_rank>,
+            Kokkos::LayoutRight,
+            MemorySpace>;
+
+    using out_view_type = Kokkos::View<
+            detail::mdspan_to_kokkos_element_t<Tout, s_rank>,
+            Kokkos::LayoutRight,
+            MemorySpace>;
+
+    using kokkos_fft_plan_type = KokkosFFT::
+            Plan<ExecSpace, in_view_type, out_view_type, transformed_axes_type::size>;
+
+    ExecSpace m_exec_space;
+
+    // KokkosFFT::Plan is neither copyable nor movable
+    std::unique_ptr<kokkos_fft_plan_type> m_plan;
+
+    FFT_Direction m_direction;
+
+    FFT_Normalization m_normalization;
+
+    DDomIn m_ddom_in;
+
+    DDomOut m_ddom_out;
+
+    detail::fft::real_type_t<Tout> m_full_norm_coef;
+
+public:
+    /// @brief The type of the logical shape of the transformed dimensions.
+    using shape_type = KokkosFFT::shape_type<transformed_axes_type::size>;
+
+    using in_span_type = ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace>;
+
+    using out_span_type = ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace>;
+
+    /**
+     * @brief Build the plan of a FFT from `in` to `out`.
+     *
+     * The data of `in` and `out` are not modified, only their domains and layouts are used.
+     *
+     * @param exec_space The Kokkos::ExecutionSpace on which the FFT is performed.
+     * @param out The output discrete function.
+     * @param in The input discrete function.
+     * @param direction The direction of the transform, it has to be FORWARD for R2C and BACKWARD for C2R.
+     * @param kwargs The kwArgs_fft configuring the FFT.
+     * @param shape The logical number of points of the transformed dimensions of the real side,
+     * deduced from the extents of `in` and `out` if zero. It is needed when they are ambiguous,
+     * as for the padded in-place R2C and C2R transforms.
+     */
+    FFTPlan(ExecSpace const& exec_space,
+            ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+            FFT_Direction const direction,
+            kwArgs_fft const kwargs = {ddc::FFT_Normalization::OFF},
+            shape_type const& shape = {})
+        : m_exec_space(exec_space)
+        , m_direction(direction)
+        , m_normalization(kwargs.normalization)
+        , m_ddom_in(in.domain())
+        , m_ddom_out(out.domain())
+        , m_full_norm_coef(1)
+    {
+        if constexpr (!std::is_same_v<Tin, Tout>) {
+            if (direction
+                != (detail::fft::is_complex_v<Tout> ? ddc::FFT_Direction::FORWARD
+                                                     : ddc::FFT_Direction::BACKWARD)) {
+                throw std::runtime_error(
+                        "R2C transforms must be FORWARD and C2R transforms must be BACKWARD");
+            }
         }
-        // R2C & C2R
-    } else {
-        if constexpr (is_complex_v<Tout>) {
-            assert(kwargs.direction == ddc::FFT_Direction::FORWARD);
-            KokkosFFT::
-                    rfftn(exec_space,
-                          in_view,
-                          out_view,
-                          axes<DDimIn...>(),
-                          kokkos_fft_normalization);
-        } else {
-            assert(kwargs.direction == ddc::FFT_Direction::BACKWARD);
-            KokkosFFT::
-                    irfftn(exec_space,
-                           in_view,
-                           out_view,
-                           axes<DDimIn...>(),
-                           kokkos_fft_normalization);
+        in_view_type const in_view = in.allocation_kokkos_view();
+        out_view_type const out_view = out.allocation_kokkos_view();
+        m_plan = std::make_unique<kokkos_fft_plan_type>(
+                exec_space,
+                in_view,
+                out_view,
+                detail::fft::ddc_fft_direction_to_kokkos_fft(direction),
+                transformed_axes_type::axes(),
+                shape);
+        // The FULL normalization is mesh-dependant and thus handled by DDC
+        if (m_normalization == ddc::FFT_Normalization::FULL) {
+            m_full_norm_coef = static_cast<detail::fft::real_type_t<Tout>>(
+                    direction == ddc::FFT_Direction::FORWARD
+                            ? detail::fft::full_norm_coef(direction, m_ddom_in, m_ddom_out)
+                            : detail::fft::full_norm_coef(direction, m_ddom_out, m_ddom_in));
         }
     }
 
-    // The FULL normalization is mesh-dependant and thus handled by DDC
-    if (kwargs.normalization == ddc::FFT_Normalization::FULL) {
-        Real norm_coef;
-        if (kwargs.direction == ddc::FFT_Direction::FORWARD) {
-            DiscreteDomain<DDimIn...> const ddom_in = in.domain();
-            norm_coef = (forward_full_norm_coef(DiscreteDomain<DDimIn>(ddom_in)) * ...);
-        } else {
-            DiscreteDomain<DDimOut...> const ddom_out = out.domain();
-            norm_coef = (backward_full_norm_coef(DiscreteDomain<DDimOut>(ddom_out)) * ...);
+    FFTPlan(FFTPlan const& other) = delete;
+
+    FFTPlan(FFTPlan&& other) noexcept = default;
+
+    ~FFTPlan() noexcept = default;
+
+    FFTPlan& operator=(FFTPlan const& other) = delete;
+
+    FFTPlan& operator=(FFTPlan&& other) noexcept = default;
+
+    /**
+     * @brief Execute the FFT.
+     *
+     * @warning C2R iFFT does NOT preserve input.
+     *
+     * @param out The output discrete function, it must be defined on the same domain as the one used to build the plan.
+     * @param in The input discrete function, it must be defined on the same domain as the one used to build the plan.
+     */
+    void operator()(
+            ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in) const
+    {
+        assert(in.domain() == m_ddom_in);
+        assert(out.domain() == m_ddom_out);
+        ddc::detail::ScopedInstrumentation const instrumentation(
+                "ddc_fft",
+                m_exec_space,
+                {in.size(), sizeof(Tin), in.size() * sizeof(Tin), out.size() * sizeof(Tout)});
+        in_view_type const in_view = in.allocation_kokkos_view();
+        out_view_type const out_view = out.allocation_kokkos_view();
+        KokkosFFT::execute(
+                *m_plan,
+                in_view,
+                out_view,
+                detail::fft::ddc_fft_normalization_to_kokkos_fft(m_normalization));
+        if (m_normalization == ddc::FFT_Normalization::FULL) {
+            detail::fft::rescale(m_exec_space, out, m_full_norm_coef);
+        }
+    }
+
+    /// @return The Kokkos::ExecutionSpace on which the FFT is performed.
+    ExecSpace const& execution_space() const noexcept
+    {
+        return m_exec_space;
+    }
+
+    /// @return The direction of the FFT.
+    FFT_Direction direction() const noexcept
+    {
+        return m_direction;
+    }
+
+    /// @return The normalization of the FFT.
+    FFT_Normalization normalization() const noexcept
+    {
+        return m_normalization;
+    }
+};
+
+} // namespace ddc
+
+namespace ddc::detail::fft {
+
+/// @brief Core internal function to perform the FFT.
+template <
+        typename Tin,
+        typename Tout,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename DDomIn,
+        typename DDomOut>
+void impl(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+        ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+        kwArgs_impl const& kwargs)
+{
+    FFTPlan<ExecSpace, Tin, Tout, DDomIn, DDomOut, MemorySpace> const
+            plan(exec_space, out, in, kwargs.direction, {kwargs.normalization});
+    plan(out, in);
+}
+
+template <typename DDimFx, typename DDimX, typename... DDim>
+DiscreteDomain<DDimFx> fourier_mesh_1d(
+        DiscreteDomain<DDim...> const& x_mesh,
+        [[maybe_unused]] DiscreteVector<DDim...> const& extents)
+{
+    if constexpr (std::is_same_v<DDimX, DDimFx>) {
+        // batch dimension
+        return DiscreteDomain<DDimX>(x_mesh);
+    } else {
+        return DiscreteDomain<DDimFx>(
+                DiscreteElement<DDimFx>(0),
+                DiscreteVector<DDimFx>(get<DDimX>(extents)));
+    }
+}
+
+/// @brief Number of points of the transformed dimensions of the mesh.
+template <typename... DDimX, typename... DDimFx>
+std::size_t transformed_size(
+        DiscreteDomain<DDimX...> const& x_mesh,
+        DiscreteDomain<DDimFx...> const&)
+{
+    return ((std::is_same_v<DDimX, DDimFx> ? 1 : DiscreteDomain<DDimX>(x_mesh).size()) * ...);
+}
+
+/// @brief Number of points of the transformed dimensions of the mesh, in increasing order.
+template <typename... DDimX, typename... DDimFx>
+KokkosFFT::shape_type<TransformedAxes<DiscreteDomain<DDimX...>, DiscreteDomain<DDimFx...>>::size>
+transformed_shape(DiscreteDomain<DDimX...> const& x_mesh, DiscreteDomain<DDimFx...> const&)
+{
+    using transformed_axes_type
+            = TransformedAxes<DiscreteDomain<DDimX...>, DiscreteDomain<DDimFx...>>;
+    std::array<bool, sizeof...(DDimX)> const is_transformed {!std::is_same_v<DDimX, DDimFx>...};
+    std::array<std::size_t, sizeof...(DDimX)> const extents {
+            DiscreteDomain<DDimX>(x_mesh).size()...};
+    KokkosFFT::shape_type<transformed_axes_type::size> shape {};
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < is_transformed.size(); ++i) {
+        if (is_transformed[i]) {
+            shape[j] = extents[i];
+            ++j;
         }
+    }
+    return shape;
+}
 
-        rescale(exec_space, out, static_cast<real_type_t<Tout>>(norm_coef));
+/**
+ * @brief Core internal function to perform the in-place FFT, `in` and `out` share the same memory.
+ *
+ * The padded real mesh of N = 2k and N = 2k + 1 points are the same, the logical shape of the
+ * transform is thus given by `x_mesh`.
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename DDomIn,
+        typename DDomOut,
+        typename... DDimX,
+        typename... DDimFx>
+void impl_inplace(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+        ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+        DiscreteDomain<DDimX...> const& x_mesh,
+        DiscreteDomain<DDimFx...> const& k_mesh,
+        kwArgs_impl const& kwargs)
+{
+    assert(static_cast<void const*>(in.data_handle())
+           == static_cast<void const*>(out.data_handle()));
+    // The padded real mesh is not the physical one, the FULL normalization is thus computed here
+    bool const full = kwargs.normalization == ddc::FFT_Normalization::FULL;
+    FFTPlan<ExecSpace, Tin, Tout, DDomIn, DDomOut, MemorySpace> const
+            plan(exec_space,
+                 out,
+                 in,
+                 kwargs.direction,
+                 {full ? ddc::FFT_Normalization::OFF : kwargs.normalization},
+                 transformed_shape(x_mesh, k_mesh));
+    plan(out, in);
+    if (full) {
+        rescale(exec_space,
+                out,
+                static_cast<real_type_t<Tout>>(full_norm_coef(kwargs.direction, x_mesh, k_mesh)));
     }
 }
 
@@ -306,12 +597,16 @@ typename DDimFx::template Impl<DDimFx, Kokkos::HostSpace> init_fourier_space(
  * Compute the Fourier (or spectral) mesh on which the Discrete Fourier Transform of a
  * discrete function is defined.
  *
+ * A DDimFx identical to the DDimX at the same position denotes a batch dimension, which is not
+ * transformed and is kept as is in the Fourier mesh.
+ *
  * @param x_mesh The DiscreteDomain representing the original mesh.
  * @param C2C A flag indicating if a complex-to-complex DFT is going to be performed. Indeed,
  * in this case the two meshes have same number of points, whereas for real-to-complex
  * or complex-to-real DFT, each complex value of the Fourier-transformed function contains twice more
  * information, and thus only half (actually Nx*Ny*(Nz/2+1) for 3D R2C FFT to take in account mode 0)
  * values are needed (cf. DFT conjugate symmetry property for more information about this).
+ * The halved dimension is the last transformed one.
  *
  * @return The domain representing the Fourier mesh.
  */
@@ -319,30 +614,49 @@ template <typename... DDimFx, typename... DDimX>
 ddc::DiscreteDomain<DDimFx...> fourier_mesh(ddc::DiscreteDomain<DDimX...> x_mesh, bool C2C)
 {
     static_assert(
-            (is_uniform_point_sampling_v<DDimX> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_uniform_point_sampling_v<DDimX>) && ...),
             "DDimX dimensions should derive from UniformPointSampling");
     static_assert(
-            (is_periodic_sampling_v<DDimFx> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_periodic_sampling_v<DDimFx>) && ...),
             "DDimFx dimensions should derive from PeriodicPointSampling");
+    using transformed_axes_type = detail::fft::
+            TransformedAxes<ddc::DiscreteDomain<DDimX...>, ddc::DiscreteDomain<DDimFx...>>;
     ddc::DiscreteVector<DDimX...> extents = x_mesh.extents();
     if (!C2C) {
-        detail::array(extents).back() = detail::array(extents).back() / 2 + 1;
+        std::size_t const last_axis = transformed_axes_type::axes().back();
+        detail::array(extents)[last_axis] = detail::array(extents)[last_axis] / 2 + 1;
     }
-    return ddc::DiscreteDomain<DDimFx...>(ddc::DiscreteDomain<DDimFx>(
-            ddc::DiscreteElement<DDimFx>(0),
-            ddc::DiscreteVector<DDimFx>(get<DDimX>(extents)))...);
+    return ddc::DiscreteDomain<DDimFx...>(
+            detail::fft::fourier_mesh_1d<DDimFx, DDimX>(x_mesh, extents)...);
 }
 
 /**
- * @brief A structure embedding the configuration of the exposed FFT function with the type of normalization.
+ * @brief Get the padded mesh of an in-place real-to-complex FFT.
  *
- * @see fft, ifft
+ * The complex values of the R2C FFT of a discrete function defined on `x_mesh` need more memory
+ * than the real values. An in-place R2C FFT thus requires the real discrete function to be
+ * allocated on a padded mesh, where the last transformed dimension has 2*(N/2+1) points instead
+ * of N. The real values are stored on `x_mesh`, which is the beginning of the padded mesh, the
+ * padding points are only used to store the complex result.
+ *
+ * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions, as for fourier_mesh.
+ *
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ *
+ * @return The domain on which the real discrete function must be allocated.
+ *
+ * @see fft_inplace, ifft_inplace
  */
-struct kwArgs_fft
+template <typename... DDimFx, typename... DDimX>
+ddc::DiscreteDomain<DDimX...> padded_real_mesh(ddc::DiscreteDomain<DDimX...> x_mesh)
 {
-    ddc::FFT_Normalization
-            normalization; ///< Enum member to identify the type of normalization performed
-};
+    using transformed_axes_type = detail::fft::
+            TransformedAxes<ddc::DiscreteDomain<DDimX...>, ddc::DiscreteDomain<DDimFx...>>;
+    ddc::DiscreteVector<DDimX...> extents = x_mesh.extents();
+    std::size_t const last_axis = transformed_axes_type::axes().back();
+    detail::array(extents)[last_axis] = 2 * (detail::array(extents)[last_axis] / 2 + 1);
+    return ddc::DiscreteDomain<DDimX...>(x_mesh.front(), extents);
+}
 
 /**
  * @brief Perform a direct Fast Fourier Transform.
@@ -350,6 +664,9 @@ struct kwArgs_fft
  * Compute the discrete Fourier transform of a function using the specialized implementation for the Kokkos::ExecutionSpace
  * of the FFT algorithm.
  *
+ * The dimensions shared by `in` and `out` (at the same position) are batch dimensions: the
+ * transform is performed along the other dimensions only, as a single batched FFT.
+ *
  * @tparam Tin The type of the input elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
  * @tparam Tout The type of the output elements (Kokkos::complex<float> or Kokkos::complex<double>).
  * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions.
@@ -385,10 +702,10 @@ void fft(
                     && std::is_same_v<LayoutOut, Kokkos::layout_right>,
             "Layouts must be right-handed");
     static_assert(
-            (is_uniform_point_sampling_v<DDimX> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_uniform_point_sampling_v<DDimX>) && ...),
             "DDimX dimensions should derive from UniformPointSampling");
     static_assert(
-            (is_periodic_sampling_v<DDimFx> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_periodic_sampling_v<DDimFx>) && ...),
             "DDimFx dimensions should derive from PeriodicPointSampling");
 
     ddc::detail::fft::
@@ -401,6 +718,9 @@ void fft(
  * Compute the inverse discrete Fourier transform of a spectral function using the specialized implementation for the Kokkos::ExecutionSpace
  * of the iFFT algorithm.
  *
+ * The dimensions shared by `in` and `out` (at the same position) are batch dimensions: the
+ * transform is performed along the other dimensions only, as a single batched iFFT.
+ *
  * @warning C2R iFFT does NOT preserve input.
  *
  * @tparam Tin The type of the input elements (Kokkos::complex<float> or Kokkos::complex<double>).
@@ -438,14 +758,284 @@ void ifft(
                     && std::is_same_v<LayoutOut, Kokkos::layout_right>,
             "Layouts must be right-handed");
     static_assert(
-            (is_uniform_point_sampling_v<DDimX> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_uniform_point_sampling_v<DDimX>) && ...),
             "DDimX dimensions should derive from UniformPointSampling");
     static_assert(
-            (is_periodic_sampling_v<DDimFx> && ...),
+            ((std::is_same_v<DDimX, DDimFx> || is_periodic_sampling_v<DDimFx>) && ...),
             "DDimFx dimensions should derive from PeriodicPointSampling");
 
     ddc::detail::fft::
             impl(exec_space, in, out, {ddc::FFT_Direction::BACKWARD, kwargs.normalization});
 }
 
+/**
+ * @brief Perform an in-place direct Fast Fourier Transform.
+ *
+ * The FFT of `inout` is computed in its own memory, no output buffer is needed.
+ * - For C2C transforms, `inout` is defined on `x_mesh`.
+ * - For R2C transforms, `inout` is defined on `padded_real_mesh<DDimFx...>(x_mesh)` and the
+ *   real values to transform are those on `x_mesh`.
+ *
+ * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions.
+ * @tparam T The type of the input elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
+ * @tparam DDimX... The parameter pack of the original discrete dimensions.
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the FFT is performed.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which is stored the discrete function.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the FFT is performed.
+ * @param inout The discrete function to transform, overwritten by the result.
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ * @param kwargs The kwArgs_fft configuring the FFT.
+ *
+ * @return A ChunkSpan over the memory of `inout` storing the result on the spectral mesh.
+ *
+ * @see padded_real_mesh
+ */
+template <
+        typename... DDimFx,
+        typename T,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace>
+ddc::ChunkSpan<
+        Kokkos::complex<detail::fft::real_type_t<T>>,
+        ddc::DiscreteDomain<DDimFx...>,
+        Kokkos::layout_right,
+        MemorySpace>
+fft_inplace(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, ddc::DiscreteDomain<DDimX...>, Kokkos::layout_right, MemorySpace> const&
+                inout,
+        ddc::DiscreteDomain<DDimX...> const& x_mesh,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            ((std::is_same_v<DDimX, DDimFx> || is_uniform_point_sampling_v<DDimX>) && ...),
+            "DDimX dimensions should derive from UniformPointSampling");
+    static_assert(
+            ((std::is_same_v<DDimX, DDimFx> || is_periodic_sampling_v<DDimFx>) && ...),
+            "DDimFx dimensions should derive from PeriodicPointSampling");
+    using Tout = Kokkos::complex<detail::fft::real_type_t<T>>;
+    constexpr bool c2c = detail::fft::is_complex_v<T>;
+
+    ddc::DiscreteDomain<DDimFx...> const k_mesh = fourier_mesh<DDimFx...>(x_mesh, c2c);
+    assert(inout.domain() == (c2c ? x_mesh : padded_real_mesh<DDimFx...>(x_mesh)));
+    ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimFx...>, Kokkos::layout_right, MemorySpace> const
+            out(reinterpret_cast<Tout*>(inout.data_handle()), k_mesh);
+    ddc::detail::fft::impl_inplace(
+            exec_space,
+            inout,
+            out,
+            x_mesh,
+            k_mesh,
+            {ddc::FFT_Direction::FORWARD, kwargs.normalization});
+    return out;
+}
+
+/**
+ * @brief Perform an in-place inverse Fast Fourier Transform.
+ *
+ * The iFFT of `inout` is computed in its own memory, no output buffer is needed.
+ * - For C2C transforms, the result is defined on `x_mesh`.
+ * - For C2R transforms, `inout` must have been allocated on `padded_real_mesh<DDimFx...>(x_mesh)`
+ *   (typically by fft_inplace), the result is defined on this padded mesh and its meaningful
+ *   values are those on `x_mesh`.
+ *
+ * @tparam Tout The type of the output elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
+ * @tparam DDimX... The parameter pack of the original discrete dimensions.
+ * @tparam T The type of the input elements (Kokkos::complex<float> or Kokkos::complex<double>).
+ * @tparam DDimFx... The parameter pack of the Fourier discrete dimensions.
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the iFFT is performed.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which is stored the discrete function.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the iFFT is performed.
+ * @param inout The spectral discrete function to transform, overwritten by the result.
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ * @param kwargs The kwArgs_fft configuring the iFFT.
+ *
+ * @return A ChunkSpan over the memory of `inout` storing the result on `x_mesh` (C2C) or on the padded mesh (C2R).
+ *
+ * @see padded_real_mesh
+ */
+template <
+        typename Tout,
+        typename... DDimX,
+        typename T,
+        typename... DDimFx,
+        typename ExecSpace,
+        typename MemorySpace>
+ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimX...>, Kokkos::layout_right, MemorySpace> ifft_inplace(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, ddc::DiscreteDomain<DDimFx...>, Kokkos::layout_right, MemorySpace> const&
+                inout,
+        ddc::DiscreteDomain<DDimX...> const& x_mesh,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            ((std::is_same_v<DDimX, DDimFx> || is_uniform_point_sampling_v<DDimX>) && ...),
+            "DDimX dimensions should derive from UniformPointSampling");
+    static_assert(
+            ((std::is_same_v<DDimX, DDimFx> || is_periodic_sampling_v<DDimFx>) && ...),
+            "DDimFx dimensions should derive from PeriodicPointSampling");
+    static_assert(detail::fft::is_complex_v<T>, "Input must be complex");
+    constexpr bool c2c = detail::fft::is_complex_v<Tout>;
+
+    assert(inout.domain() == fourier_mesh<DDimFx...>(x_mesh, c2c));
+    ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimX...>, Kokkos::layout_right, MemorySpace> const
+            out(reinterpret_cast<Tout*>(inout.data_handle()),
+                c2c ? x_mesh : padded_real_mesh<DDimFx...>(x_mesh));
+    ddc::detail::fft::impl_inplace(
+            exec_space,
+            inout,
+            out,
+            x_mesh,
+            inout.domain(),
+            {ddc::FFT_Direction::BACKWARD, kwargs.normalization});
+    return out;
+}
+
+/**
+ * @brief A spectral operator, ie. the composition of a FFT, a pointwise multiplication by a symbol
+ * in the spectral space and an iFFT.
+ *
+ * The plans and the spectral workspace are built once at construction and reused at each
+ * application. The normalizations of both transforms are folded with the symbol in a single kernel
+ * between the transforms, so that an application costs the two transforms and one pass over the
+ * spectral workspace. As the iFFT of the FFT is the identity for all normalizations but OFF, the
+ * result does not depend on the normalization in that case.
+ *
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the operator is applied.
+ * @tparam T The type of the elements (float, Kokkos::complex<float>, double or Kokkos::complex<double>).
+ * @tparam DDomX The type of the DiscreteDomain of the discrete functions.
+ * @tparam DDomFx The type of the DiscreteDomain of the spectral workspace.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which are stored the discrete functions.
+ */
+template <typename ExecSpace, typename T, typename DDomX, typename DDomFx, typename MemorySpace>
+class SpectralOperator
+{
+    using spectral_element_type = Kokkos::complex<detail::fft::real_type_t<T>>;
+
+    using workspace_type = ddc::
+            Chunk<spectral_element_type,
+                  DDomFx,
+                  ddc::KokkosAllocator<spectral_element_type, MemorySpace>>;
+
+public:
+    using span_type = ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace>;
+
+    using spectral_span_type
+            = ddc::ChunkSpan<spectral_element_type, DDomFx, Kokkos::layout_right, MemorySpace>;
+
+private:
+    ExecSpace m_exec_space;
+
+    workspace_type m_workspace;
+
+    FFTPlan<ExecSpace, T, spectral_element_type, DDomX, DDomFx, MemorySpace> m_fft_plan;
+
+    FFTPlan<ExecSpace, spectral_element_type, T, DDomFx, DDomX, MemorySpace> m_ifft_plan;
+
+    detail::fft::real_type_t<T> m_scale;
+
+public:
+    /**
+     * @brief Build the plans and the workspace of a spectral operator from `in` to `out`.
+     *
+     * @param exec_space The Kokkos::ExecutionSpace on which the operator is applied.
+     * @param out The output discrete function, only its domain is used.
+     * @param in The input discrete function, only its domain is used.
+     * @param k_mesh The spectral mesh, as returned by fourier_mesh.
+     * @param kwargs The kwArgs_fft configuring the transforms.
+     */
+    SpectralOperator(
+            ExecSpace const& exec_space,
+            ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& in,
+            DDomFx const& k_mesh,
+            kwArgs_fft const kwargs = {ddc::FFT_Normalization::OFF})
+        : m_exec_space(exec_space)
+        , m_workspace(
+                  "ddc_spectral_operator_workspace",
+                  k_mesh,
+                  ddc::KokkosAllocator<spectral_element_type, MemorySpace>())
+        , m_fft_plan(exec_space, m_workspace.span_view(), in, ddc::FFT_Direction::FORWARD)
+        , m_ifft_plan(exec_space, out, m_workspace.span_view(), ddc::FFT_Direction::BACKWARD)
+        , m_scale(
+                  kwargs.normalization == ddc::FFT_Normalization::OFF
+                          ? 1
+                          : detail::fft::real_type_t<T>(1)
+                                    / detail::fft::transformed_size(in.domain(), k_mesh))
+    {
+    }
+
+    /**
+     * @brief Apply the spectral operator: out = iFFT(symbol * FFT(in)).
+     *
+     * `in` is preserved.
+     *
+     * @param out The output discrete function.
+     * @param in The input discrete function.
+     * @param symbol A functor callable on the device with a DDomFx::discrete_element_type and returning the value of the symbol.
+     */
+    template <typename Symbol>
+    void operator()(
+            ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& in,
+            Symbol const& symbol)
+    {
+        spectral_span_type const workspace = m_workspace.span_view();
+        m_fft_plan(workspace, in);
+        detail::fft::real_type_t<T> const scale = m_scale;
+        ddc::parallel_for_each(
+                "ddc_spectral_operator",
+                m_exec_space,
+                workspace.domain(),
+                KOKKOS_LAMBDA(typename DDomFx::discrete_element_type const ik) {
+                    workspace(ik) *= spectral_element_type(symbol(ik)) * scale;
+                });
+        m_ifft_plan(out, workspace);
+    }
+
+    /// @return The spectral workspace, overwritten by each application of the operator.
+    spectral_span_type workspace()
+    {
+        return m_workspace.span_view();
+    }
+};
+
+/**
+ * @brief Apply a spectral operator: out = iFFT(symbol * FFT(in)).
+ *
+ * The plans and the workspace are built for this call only, use SpectralOperator to reuse them
+ * across calls.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the operator is applied.
+ * @param out The output discrete function.
+ * @param in The input discrete function, it is preserved.
+ * @param k_mesh The spectral mesh, as returned by fourier_mesh.
+ * @param symbol A functor callable on the device with an element of `k_mesh` and returning the value of the symbol.
+ * @param kwargs The kwArgs_fft configuring the transforms.
+ *
+ * @see SpectralOperator
+ */
+template <
+        typename ExecSpace,
+        typename T,
+        typename DDomX,
+        typename DDomFx,
+        typename MemorySpace,
+        typename Symbol>
+void apply_spectral_operator(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& out,
+        ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& in,
+        DDomFx const& k_mesh,
+        Symbol const& symbol,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    SpectralOperator<ExecSpace, T, DDomX, DDomFx, MemorySpace>
+            spectral_operator(exec_space, out, in, k_mesh, kwargs);
+    spectral_operator(out, in, symbol);
+}
+
 } // namespace ddc
@@ -0,0 +1,532 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "dealiasing.hpp"
+#include "fft.hpp"
+
+namespace ddc::detail::nufft {
+
+/// Tag of the oversampled uniform grid on which the non-uniform values are spread.
+template <typename DDimX>
+struct GridDim
+{
+};
+
+/// Tag of the Fourier modes of the oversampled grid.
+template <typename DDimX>
+struct GridModeDim
+{
+};
+
+template <typename DDomX>
+struct GridDomains;
+
+template <typename... DDimX>
+struct GridDomains<DiscreteDomain<DDimX...>>
+{
+    using grid_type = DiscreteDomain<GridDim<DDimX>...>;
+
+    using modes_type = DiscreteDomain<GridModeDim<DDimX>...>;
+
+    /// @return The grid oversampling the Fourier mesh `k_mesh` by a factor `oversampling`.
+    template <typename... DDimFx>
+    static grid_type grid(DiscreteDomain<DDimFx...> const& k_mesh, int const oversampling)
+    {
+        return grid_type(
+                DiscreteElement<GridDim<DDimX>...>(
+                        create_reference_discrete_element<GridDim<DDimX>>()...),
+                DiscreteVector<GridDim<DDimX>...>(
+                        oversampling * get<DDimFx>(k_mesh.extents())...));
+    }
+
+    /// @return The Fourier modes of `grid`.
+    static modes_type modes(grid_type const& grid)
+    {
+        return modes_type(
+                DiscreteElement<GridModeDim<DDimX>...>(
+                        create_reference_discrete_element<GridModeDim<DDimX>>()...),
+                DiscreteVector<GridModeDim<DDimX>...>(get<GridDim<DDimX>>(grid.extents())...));
+    }
+};
+
+/// @return The fundamental wavenumbers 2*pi/L of the Fourier dimensions.
+template <typename Real, typename... DDimFx>
+std::array<Real, sizeof...(DDimFx)> fundamental_wavenumbers(DiscreteDomain<DDimFx...> const&)
+{
+    return {static_cast<Real>(ddc::step<DDimFx>())...};
+}
+
+/**
+ * @brief The coordinates of a point scaled by the fundamental wavenumbers and wrapped in [0, 2*pi).
+ */
+template <typename Real, typename... DDimX>
+KOKKOS_FUNCTION std::array<Real, sizeof...(DDimX)> angles(
+        DiscreteElement<DDimX...> const& e,
+        std::array<Real, sizeof...(DDimX)> const& wavenumbers)
+{
+    Real const two_pi = 2 * Kokkos::numbers::pi_v<Real>;
+    std::array<Real, sizeof...(DDimX)> theta {
+            static_cast<Real>(ddc::coordinate(DiscreteElement<DDimX>(e)))...};
+    for (std::size_t d = 0; d < theta.size(); ++d) {
+        theta[d] *= wavenumbers[d];
+        theta[d] -= two_pi * Kokkos::floor(theta[d] / two_pi);
+    }
+    return theta;
+}
+
+/**
+ * @brief Call `f(position, weight)` on the points of the oversampled grid in the support of the
+ * Gaussian kernel centered on `theta`.
+ *
+ * The kernel is the tensor product of exp(-x^2/(4*tau)), truncated to 2*HalfWidth points per
+ * dimension. The positions are wrapped periodically in the grid.
+ */
+template <int HalfWidth, typename Real, std::size_t Rank, typename F>
+KOKKOS_FUNCTION void gaussian_stencil(
+        std::array<Real, Rank> const& theta,
+        std::array<DiscreteVectorElement, Rank> const& n_grid,
+        std::array<Real, Rank> const& tau,
+        F const& f)
+{
+    constexpr int width = 2 * HalfWidth;
+    std::array<std::array<Real, width>, Rank> weights;
+    std::array<DiscreteVectorElement, Rank> first;
+    int n_points = 1;
+    for (std::size_t d = 0; d < Rank; ++d) {
+        Real const h = 2 * Kokkos::numbers::pi_v<Real> / n_grid[d];
+        first[d] = static_cast<DiscreteVectorElement>(Kokkos::floor(theta[d] / h)) - HalfWidth
+                   + 1;
+        for (int o = 0; o < width; ++o) {
+            Real const distance = theta[d] - (first[d] + o) * h;
+            weights[d][o] = Kokkos::exp(-distance * distance / (4 * tau[d]));
+        }
+        n_points *= width;
+    }
+    for (int t = 0; t < n_points; ++t) {
+        std::array<DiscreteVectorElement, Rank> position;
+        Real weight = 1;
+        int r = t;
+        for (std::size_t d = 0; d < Rank; ++d) {
+            int const o = r % width;
+            r /= width;
+            DiscreteVectorElement const l = (first[d] + o) % n_grid[d];
+            position[d] = l < 0 ? l + n_grid[d] : l;
+            weight *= weights[d][o];
+        }
+        f(position, weight);
+    }
+}
+
+/**
+ * @brief The deconvolution coefficient of a mode, ie. the inverse of the Fourier transform of the
+ * Gaussian kernel, including the normalization of the discrete sums on the grid.
+ */
+template <typename Real, std::size_t Rank>
+KOKKOS_FUNCTION Real deconvolution_coef(
+        std::array<DiscreteVectorElement, Rank> const& mode,
+        std::array<DiscreteVectorElement, Rank> const& n_grid,
+        std::array<Real, Rank> const& tau)
+{
+    Real coef = 1;
+    for (std::size_t d = 0; d < Rank; ++d) {
+        Real const k = mode[d];
+        coef *= Kokkos::sqrt(Kokkos::numbers::pi_v<Real> / tau[d]) * Kokkos::exp(k * k * tau[d])
+                / n_grid[d];
+    }
+    return coef;
+}
+
+/**
+ * @brief Call `f(ik, ip, coef)` on each element `ik` of the Fourier mesh, with `ip` the
+ * corresponding element of the modes of the oversampled grid and `coef` its deconvolution
+ * coefficient.
+ */
+template <typename ExecSpace, typename DDomFx, typename DDomModes, typename Real, typename F>
+void for_each_mode(
+        char const* const label,
+        ExecSpace const& exec_space,
+        DDomFx const& k_mesh,
+        DDomModes const& modes_mesh,
+        std::array<Real, DDomFx::rank()> const& tau,
+        F const& f)
+{
+    constexpr std::size_t rank = DDomFx::rank();
+    typename DDomFx::discrete_element_type const k_front = k_mesh.front();
+    typename DDomModes::discrete_element_type const modes_front = modes_mesh.front();
+    std::array<DiscreteVectorElement, rank> const n_modes = detail::array(k_mesh.extents());
+    std::array<DiscreteVectorElement, rank> const n_grid = detail::array(modes_mesh.extents());
+    ddc::parallel_for_each(
+            label,
+            exec_space,
+            k_mesh,
+            KOKKOS_LAMBDA(typename DDomFx::discrete_element_type const ik) {
+                std::array<DiscreteVectorElement, rank> const i = detail::array(ik - k_front);
+                std::array<DiscreteVectorElement, rank> mode;
+                typename DDomModes::discrete_vector_type position;
+                for (std::size_t d = 0; d < rank; ++d) {
+                    mode[d] = i[d] < (n_modes[d] + 1) / 2 ? i[d] : i[d] - n_modes[d];
+                    detail::array(position)[d]
+                            = fft::padded_mode_position(i[d], n_modes[d], n_grid[d], false);
+                }
+                f(ik, modes_front + position, deconvolution_coef(mode, n_grid, tau));
+            });
+}
+
+} // namespace ddc::detail::nufft
+
+namespace ddc {
+
+/**
+ * @brief Initialize a Fourier discrete dimension for a non-uniform FFT.
+ *
+ * It is the discrete space init_fourier_space would give for a uniform mesh of `n_modes` points
+ * over a period of length `length`.
+ *
+ * @tparam DDimFx A PeriodicSampling representing the Fourier discrete dimension.
+ *
+ * @param length The length of the period of the non-uniform points.
+ * @param n_modes The number of Fourier modes.
+ *
+ * @return The initialized Impl representing the discrete Fourier space.
+ *
+ * @see NUFFTPlan
+ */
+template <typename DDimFx>
+typename DDimFx::template Impl<DDimFx, Kokkos::HostSpace> init_nufft_fourier_space(
+        Real const length,
+        std::size_t const n_modes)
+{
+    static_assert(
+            is_periodic_sampling_v<DDimFx>,
+            "DDimFx dimension must derive from PeriodicSampling");
+    using CDimFx = typename DDimFx::continuous_dimension_type;
+    auto [impl, ddom] = DDimFx::template init<DDimFx>(
+            ddc::Coordinate<CDimFx>(0),
+            ddc::Coordinate<CDimFx>(2 * Kokkos::numbers::pi * (n_modes - 1) / length),
+            ddc::DiscreteVector<DDimFx>(n_modes),
+            ddc::DiscreteVector<DDimFx>(n_modes));
+    return std::move(impl);
+}
+
+/**
+ * @brief A reusable plan of non-uniform Fast Fourier Transform, between non-uniformly sampled
+ * points and Fourier modes.
+ *
+ * With x_j the points of the non-uniform mesh and k the wavenumbers of the Fourier mesh:
+ * - the forward (type 1) transform computes F(k) = sum_j f(x_j) exp(-i*k*x_j),
+ * - the backward (type 2) transform computes f(x_j) = sum_k F(k) exp(i*k*x_j).
+ * As for FFT_Normalization::OFF, the sums are not normalized.
+ *
+ * The transforms use Gaussian gridding (Greengard and Lee, 2004): the values are spread by a
+ * Gaussian kernel on a twice oversampled uniform grid, transformed by a FFT and the effect of the
+ * kernel is divided out in the spectral space. The oversampled workspace, the FFT plans and the
+ * kernel parameters are built once at construction and reused at each execution, as for FFTPlan.
+ * The result has a relative accuracy of about 1e-12 in double precision and 1e-6 in single
+ * precision.
+ *
+ * The period of the points along each dimension is 2*pi/dk, with dk the step of the Fourier
+ * dimension, and the points may be anywhere in the real line.
+ *
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace on which the transforms are performed.
+ * @tparam T The type of the elements (Kokkos::complex<float> or Kokkos::complex<double>).
+ * @tparam DDomX The type of the DiscreteDomain of the non-uniform points, its dimensions derive from NonUniformPointSampling.
+ * @tparam DDomFx The type of the DiscreteDomain of the Fourier modes, its dimensions derive from PeriodicSampling.
+ * @tparam MemorySpace The type of the Kokkos::MemorySpace on which are stored the discrete functions.
+ *
+ * @see init_nufft_fourier_space, nufft, infft
+ */
+template <typename ExecSpace, typename T, typename DDomX, typename DDomFx, typename MemorySpace>
+class NUFFTPlan
+{
+    static_assert(
+            detail::fft::is_complex_v<T>,
+            "T must be Kokkos::complex<float> or Kokkos::complex<double>");
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+            "MemorySpace has to be accessible for ExecutionSpace.");
+
+    using real_type = detail::fft::real_type_t<T>;
+
+    using grid_domain_type = typename detail::nufft::GridDomains<DDomX>::grid_type;
+
+    using modes_domain_type = typename detail::nufft::GridDomains<DDomX>::modes_type;
+
+    using workspace_type
+            = ddc::Chunk<T, grid_domain_type, ddc::KokkosAllocator<T, MemorySpace>>;
+
+    using grid_span_type = ddc::ChunkSpan<T, grid_domain_type, Kokkos::layout_right, MemorySpace>;
+
+    using modes_span_type
+            = ddc::ChunkSpan<T, modes_domain_type, Kokkos::layout_right, MemorySpace>;
+
+    static constexpr std::size_t s_rank = DDomX::rank();
+
+    // Half width of the Gaussian kernel, in points of the oversampled grid
+    static constexpr int s_half_width = std::is_same_v<real_type, double> ? 12 : 6;
+
+    static constexpr int s_oversampling = 2;
+
+    ExecSpace m_exec_space;
+
+    DDomX m_x_mesh;
+
+    DDomFx m_k_mesh;
+
+    workspace_type m_workspace;
+
+    FFTPlan<ExecSpace, T, T, grid_domain_type, modes_domain_type, MemorySpace> m_fft_plan;
+
+    FFTPlan<ExecSpace, T, T, modes_domain_type, grid_domain_type, MemorySpace> m_ifft_plan;
+
+    std::array<real_type, s_rank> m_wavenumbers;
+
+    std::array<real_type, s_rank> m_tau;
+
+    /// @return A span over the workspace, viewed as the Fourier modes of the oversampled grid.
+    modes_span_type modes()
+    {
+        return modes_span_type(
+                m_workspace.span_view().data_handle(),
+                detail::nufft::GridDomains<DDomX>::modes(m_workspace.domain()));
+    }
+
+public:
+    /**
+     * @brief Build the plan of the non-uniform FFTs between `x_mesh` and `k_mesh`.
+     *
+     * @param exec_space The Kokkos::ExecutionSpace on which the transforms are performed.
+     * @param k_mesh The Fourier mesh.
+     * @param x_mesh The non-uniform mesh.
+     */
+    NUFFTPlan(ExecSpace const& exec_space, DDomFx const& k_mesh, DDomX const& x_mesh)
+        : m_exec_space(exec_space)
+        , m_x_mesh(x_mesh)
+        , m_k_mesh(k_mesh)
+        , m_workspace(
+                  "ddc_nufft_workspace",
+                  detail::nufft::GridDomains<DDomX>::grid(k_mesh, s_oversampling),
+                  ddc::KokkosAllocator<T, MemorySpace>())
+        , m_fft_plan(exec_space, modes(), m_workspace.span_view(), ddc::FFT_Direction::FORWARD)
+        , m_ifft_plan(exec_space, m_workspace.span_view(), modes(), ddc::FFT_Direction::BACKWARD)
+        , m_wavenumbers(detail::nufft::fundamental_wavenumbers<real_type>(k_mesh))
+    {
+        // Width of the Gaussian kernel from Greengard and Lee (2004)
+        for (std::size_t d = 0; d < s_rank; ++d) {
+            real_type const n_modes = detail::array(k_mesh.extents())[d];
+            m_tau[d] = Kokkos::numbers::pi_v<real_type> * s_half_width
+                       / (n_modes * n_modes * s_oversampling * (s_oversampling - 0.5));
+        }
+    }
+
+    NUFFTPlan(NUFFTPlan const& other) = delete;
+
+    NUFFTPlan(NUFFTPlan&& other) noexcept = default;
+
+    ~NUFFTPlan() noexcept = default;
+
+    NUFFTPlan& operator=(NUFFTPlan const& other) = delete;
+
+    NUFFTPlan& operator=(NUFFTPlan&& other) noexcept = default;
+
+    /**
+     * @brief Execute the forward (type 1) transform, from the non-uniform points to the Fourier modes.
+     *
+     * @param out The output spectral discrete function, defined on the Fourier mesh.
+     * @param in The input discrete function, defined on the non-uniform mesh. It is preserved.
+     */
+    template <typename Tin>
+    void forward(
+            ddc::ChunkSpan<T, DDomFx, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<Tin, DDomX, Kokkos::layout_right, MemorySpace> const& in)
+    {
+        assert(in.domain() == m_x_mesh);
+        assert(out.domain() == m_k_mesh);
+        grid_span_type const grid = m_workspace.span_view();
+        typename grid_domain_type::discrete_element_type const grid_front = grid.domain().front();
+        std::array<DiscreteVectorElement, s_rank> const n_grid
+                = detail::array(grid.domain().extents());
+        std::array<real_type, s_rank> const wavenumbers = m_wavenumbers;
+        std::array<real_type, s_rank> const tau = m_tau;
+        ddc::parallel_fill(m_exec_space, grid, T(0));
+        ddc::parallel_for_each(
+                "ddc_nufft_spread",
+                m_exec_space,
+                m_x_mesh,
+                KOKKOS_LAMBDA(typename DDomX::discrete_element_type const ix) {
+                    T const value(in(ix));
+                    detail::nufft::gaussian_stencil<s_half_width>(
+                            detail::nufft::angles(ix, wavenumbers),
+                            n_grid,
+                            tau,
+                            [&](std::array<DiscreteVectorElement, s_rank> const& position,
+                                real_type const weight) {
+                                typename grid_domain_type::discrete_vector_type offset;
+                                detail::array(offset) = position;
+                                Kokkos::atomic_add(&grid(grid_front + offset), value * weight);
+                            });
+                });
+        modes_span_type const spectrum = modes();
+        m_fft_plan(spectrum, grid);
+        detail::nufft::for_each_mode(
+                "ddc_nufft_deconvolve",
+                m_exec_space,
+                m_k_mesh,
+                spectrum.domain(),
+                m_tau,
+                KOKKOS_LAMBDA(
+                        typename DDomFx::discrete_element_type const ik,
+                        typename modes_domain_type::discrete_element_type const ip,
+                        real_type const coef) { out(ik) = spectrum(ip) * coef; });
+    }
+
+    /**
+     * @brief Execute the backward (type 2) transform, from the Fourier modes to the non-uniform points.
+     *
+     * @param out The output discrete function, defined on the non-uniform mesh.
+     * @param in The input spectral discrete function, defined on the Fourier mesh. It is preserved.
+     */
+    template <typename Tin>
+    void backward(
+            ddc::ChunkSpan<T, DDomX, Kokkos::layout_right, MemorySpace> const& out,
+            ddc::ChunkSpan<Tin, DDomFx, Kokkos::layout_right, MemorySpace> const& in)
+    {
+        assert(in.domain() == m_k_mesh);
+        assert(out.domain() == m_x_mesh);
+        grid_span_type const grid = m_workspace.span_view();
+        modes_span_type const spectrum = modes();
+        ddc::parallel_fill(m_exec_space, grid, T(0));
+        detail::nufft::for_each_mode(
+                "ddc_nufft_deconvolve",
+                m_exec_space,
+                m_k_mesh,
+                spectrum.domain(),
+                m_tau,
+                KOKKOS_LAMBDA(
+                        typename DDomFx::discrete_element_type const ik,
+                        typename modes_domain_type::discrete_element_type const ip,
+                        real_type const coef) { spectrum(ip) = T(in(ik)) * coef; });
+        m_ifft_plan(grid, spectrum);
+        typename grid_domain_type::discrete_element_type const grid_front = grid.domain().front();
+        std::array<DiscreteVectorElement, s_rank> const n_grid
+                = detail::array(grid.domain().extents());
+        std::array<real_type, s_rank> const wavenumbers = m_wavenumbers;
+        std::array<real_type, s_rank> const tau = m_tau;
+        ddc::parallel_for_each(
+                "ddc_nufft_interpolate",
+                m_exec_space,
+                m_x_mesh,
+                KOKKOS_LAMBDA(typename DDomX::discrete_element_type const ix) {
+                    T value(0);
+                    detail::nufft::gaussian_stencil<s_half_width>(
+                            detail::nufft::angles(ix, wavenumbers),
+                            n_grid,
+                            tau,
+                            [&](std::array<DiscreteVectorElement, s_rank> const& position,
+                                real_type const weight) {
+                                typename grid_domain_type::discrete_vector_type offset;
+                                detail::array(offset) = position;
+                                value += grid(grid_front + offset) * weight;
+                            });
+                    out(ix) = value;
+                });
+    }
+
+    /// @return The Kokkos::ExecutionSpace on which the transforms are performed.
+    ExecSpace const& execution_space() const noexcept
+    {
+        return m_exec_space;
+    }
+};
+
+/**
+ * @brief Perform a non-uniform direct (type 1) Fast Fourier Transform.
+ *
+ * The plan is built for this call only, use NUFFTPlan to reuse it across calls.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the transform is performed.
+ * @param out The output spectral discrete function, defined on a Fourier mesh.
+ * @param in The input discrete function, defined on a non-uniform mesh. It is preserved.
+ *
+ * @see NUFFTPlan
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimFx,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace>
+void nufft(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimFx...>, Kokkos::layout_right, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimX...>, Kokkos::layout_right, MemorySpace> in)
+{
+    static_assert(
+            (is_non_uniform_point_sampling_v<DDimX> && ...),
+            "DDimX dimensions should derive from NonUniformPointSampling");
+    static_assert(
+            (is_periodic_sampling_v<DDimFx> && ...),
+            "DDimFx dimensions should derive from PeriodicPointSampling");
+    NUFFTPlan<
+            ExecSpace,
+            Tout,
+            ddc::DiscreteDomain<DDimX...>,
+            ddc::DiscreteDomain<DDimFx...>,
+            MemorySpace>
+            plan(exec_space, out.domain(), in.domain());
+    plan.forward(out, in);
+}
+
+/**
+ * @brief Perform a non-uniform inverse (type 2) Fast Fourier Transform.
+ *
+ * The plan is built for this call only, use NUFFTPlan to reuse it across calls.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace on which the transform is performed.
+ * @param out The output discrete function, defined on a non-uniform mesh.
+ * @param in The input spectral discrete function, defined on a Fourier mesh. It is preserved.
+ *
+ * @see NUFFTPlan
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimX,
+        typename... DDimFx,
+        typename ExecSpace,
+        typename MemorySpace>
+void infft(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimX...>, Kokkos::layout_right, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimFx...>, Kokkos::layout_right, MemorySpace> in)
+{
+    static_assert(
+            (is_non_uniform_point_sampling_v<DDimX> && ...),
+            "DDimX dimensions should derive from NonUniformPointSampling");
+    static_assert(
+            (is_periodic_sampling_v<DDimFx> && ...),
+            "DDimFx dimensions should derive from PeriodicPointSampling");
+    NUFFTPlan<
+            ExecSpace,
+            Tout,
+            ddc::DiscreteDomain<DDimX...>,
+            ddc::DiscreteDomain<DDimFx...>,
+            MemorySpace>
+            plan(exec_space, in.domain(), out.domain());
+    plan.backward(out, in);
+}
+
+} // namespace ddc
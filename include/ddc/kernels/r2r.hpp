@@ -0,0 +1,505 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <KokkosFFT.hpp>
+#include <Kokkos_Core.hpp>
+
+#include "fft.hpp"
+
+#if defined(KOKKOSFFT_ENABLE_TPL_FFTW)
+
+#    include <fftw3.h>
+
+namespace ddc {
+
+/**
+ * @brief A templated tag representing a continuous dimension in the cosine space associated to the original continuous dimension.
+ *
+ * @tparam The tag representing the original dimension.
+ */
+template <typename Dim>
+struct Cosine;
+
+/**
+ * @brief A templated tag representing a continuous dimension in the sine space associated to the original continuous dimension.
+ *
+ * @tparam The tag representing the original dimension.
+ */
+template <typename Dim>
+struct Sine;
+
+} // namespace ddc
+
+namespace ddc::detail::r2r {
+
+template <typename T>
+struct Fftw;
+
+template <>
+struct Fftw<double>
+{
+    using plan_type = fftw_plan;
+
+    static plan_type plan(
+            int const rank,
+            fftw_iodim64 const* const dims,
+            int const howmany_rank,
+            fftw_iodim64 const* const howmany_dims,
+            double* const in,
+            double* const out,
+            fftw_r2r_kind const* const kinds)
+    {
+        return fftw_plan_guru64_r2r(
+                rank,
+                dims,
+                howmany_rank,
+                howmany_dims,
+                in,
+                out,
+                kinds,
+                FFTW_ESTIMATE);
+    }
+
+    static void execute(plan_type const plan, double* const in, double* const out)
+    {
+        fftw_execute_r2r(plan, in, out);
+    }
+
+    static void destroy(plan_type const plan)
+    {
+        fftw_destroy_plan(plan);
+    }
+};
+
+template <>
+struct Fftw<float>
+{
+    using plan_type = fftwf_plan;
+
+    static plan_type plan(
+            int const rank,
+            fftw_iodim64 const* const dims,
+            int const howmany_rank,
+            fftw_iodim64 const* const howmany_dims,
+            float* const in,
+            float* const out,
+            fftw_r2r_kind const* const kinds)
+    {
+        return fftwf_plan_guru64_r2r(
+                rank,
+                dims,
+                howmany_rank,
+                howmany_dims,
+                in,
+                out,
+                kinds,
+                FFTW_ESTIMATE);
+    }
+
+    static void execute(plan_type const plan, float* const in, float* const out)
+    {
+        fftwf_execute_r2r(plan, in, out);
+    }
+
+    static void destroy(plan_type const plan)
+    {
+        fftwf_destroy_plan(plan);
+    }
+};
+
+/*
+ * @brief The kind of a real-to-real transform.
+ *
+ * The DCT-II and DST-II are the forward transforms, their inverses up to a factor 2N are the
+ * DCT-III and DST-III.
+ */
+enum class R2R_Kind { COSINE, SINE };
+
+inline fftw_r2r_kind to_fftw_kind(R2R_Kind const kind, FFT_Direction const direction)
+{
+    if (kind == R2R_Kind::COSINE) {
+        return direction == ddc::FFT_Direction::FORWARD ? FFTW_REDFT10 : FFTW_REDFT01;
+    }
+    return direction == ddc::FFT_Direction::FORWARD ? FFTW_RODFT10 : FFTW_RODFT01;
+}
+
+/// @brief Core internal function to perform the real-to-real transforms with FFTW.
+template <
+        typename Tin,
+        typename Tout,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename DDomIn,
+        typename DDomOut>
+void impl(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tin, DDomIn, Kokkos::layout_right, MemorySpace> const& in,
+        ddc::ChunkSpan<Tout, DDomOut, Kokkos::layout_right, MemorySpace> const& out,
+        R2R_Kind const kind,
+        FFT_Direction const direction,
+        FFT_Normalization const normalization)
+{
+    static_assert(
+            std::is_same_v<Tout, float> || std::is_same_v<Tout, double>,
+            "Tout must be float or double.");
+    static_assert(
+            std::is_same_v<std::remove_const_t<Tin>, Tout>,
+            "Types Tin and Tout must be the same (float or double)");
+    static_assert(
+            Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible,
+            "Real-to-real transforms are only available on host accessible memory spaces.");
+
+    using transformed_axes_type = detail::fft::TransformedAxes<DDomIn, DDomOut>;
+    constexpr std::size_t rank = DDomIn::rank();
+    constexpr std::size_t nb_transformed = transformed_axes_type::size;
+    constexpr KokkosFFT::axis_type<nb_transformed> axes = transformed_axes_type::axes();
+
+    if (normalization != ddc::FFT_Normalization::OFF
+        && normalization != ddc::FFT_Normalization::FORWARD
+        && normalization != ddc::FFT_Normalization::BACKWARD) {
+        throw std::runtime_error(
+                "Real-to-real transforms only support OFF, FORWARD and BACKWARD normalizations");
+    }
+
+    std::array<DiscreteVectorElement, rank> const extents = detail::array(in.domain().extents());
+    assert(extents == detail::array(out.domain().extents()));
+    std::array<DiscreteVectorElement, rank> strides;
+    strides[rank - 1] = 1;
+    for (std::size_t i = rank - 1; i > 0; --i) {
+        strides[i - 1] = strides[i] * extents[i];
+    }
+
+    // The 64-bit guru interface avoids narrowing the extents and strides of large chunks to int
+    std::array<fftw_iodim64, nb_transformed> dims;
+    std::array<fftw_r2r_kind, nb_transformed> kinds;
+    std::array<fftw_iodim64, rank - nb_transformed + 1> howmany_dims;
+    int howmany_rank = 0;
+    DiscreteVectorElement logical_size = 1;
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < rank; ++i) {
+        fftw_iodim64 const dim {
+                static_cast<std::ptrdiff_t>(extents[i]),
+                static_cast<std::ptrdiff_t>(strides[i]),
+                static_cast<std::ptrdiff_t>(strides[i])};
+        if (j < nb_transformed && axes[j] == static_cast<int>(i)) {
+            dims[j] = dim;
+            kinds[j] = to_fftw_kind(kind, direction);
+            logical_size *= 2 * extents[i];
+            ++j;
+        } else {
+            howmany_dims[howmany_rank] = dim;
+            ++howmany_rank;
+        }
+    }
+
+    Tout* const in_ptr = const_cast<Tout*>(in.data_handle());
+    Tout* const out_ptr = out.data_handle();
+    // FFTW_ESTIMATE planning does not touch the arrays
+    typename Fftw<Tout>::plan_type const plan = Fftw<Tout>::plan(
+            static_cast<int>(nb_transformed),
+            dims.data(),
+            howmany_rank,
+            howmany_dims.data(),
+            in_ptr,
+            out_ptr,
+            kinds.data());
+    if (plan == nullptr) {
+        throw std::runtime_error("FFTW failed to create the real-to-real plan");
+    }
+    // The input may have been written by asynchronous kernels
+    exec_space.fence();
+    Fftw<Tout>::execute(plan, in_ptr, out_ptr);
+    Fftw<Tout>::destroy(plan);
+
+    if ((normalization == ddc::FFT_Normalization::FORWARD
+         && direction == ddc::FFT_Direction::FORWARD)
+        || (normalization == ddc::FFT_Normalization::BACKWARD
+            && direction == ddc::FFT_Direction::BACKWARD)) {
+        detail::fft::rescale(exec_space, out, Tout(1) / static_cast<Tout>(logical_size));
+    }
+}
+
+template <typename DDimKx, typename DDimX>
+typename DDimKx::template Impl<DDimKx, Kokkos::HostSpace> init_mode_space(
+        ddc::DiscreteDomain<DDimX> const& x_mesh,
+        int const first_mode)
+{
+    static_assert(
+            is_uniform_point_sampling_v<DDimX>,
+            "DDimX dimension must derive from UniformPointSampling");
+    static_assert(
+            is_uniform_point_sampling_v<DDimKx>,
+            "DDimKx dimension must derive from UniformPointSampling");
+    using CDimKx = typename DDimKx::continuous_dimension_type;
+
+    // The cell-centered mesh covers a box of length N*dx
+    double const lx = ddc::rlength(x_mesh) * x_mesh.size() / (x_mesh.size() - 1);
+    double const dk = Kokkos::numbers::pi / lx;
+    return typename DDimKx::template Impl<DDimKx, Kokkos::HostSpace>(
+            ddc::Coordinate<CDimKx>(first_mode * dk),
+            ddc::Coordinate<CDimKx>(dk));
+}
+
+} // namespace ddc::detail::r2r
+
+namespace ddc {
+
+/**
+ * @brief Initialize a cosine discrete dimension.
+ *
+ * Initialize the (1D) discrete space representing the modes of the DCT-II of a discrete function
+ * defined on the (1D) cell-centered mesh passed as argument, ie. with homogeneous Neumann
+ * boundary conditions at half a cell from the first and last points. It is a UniformPointSampling
+ * with wavenumbers k_m = m*pi/L, m = 0..N-1, where L = N*dx is the length of the box.
+ *
+ * @tparam DDimKx A UniformPointSampling over ddc::Cosine<CDimX> representing the cosine discrete dimension.
+ * @tparam DDimX The type of the original discrete dimension.
+ *
+ * @param x_mesh The DiscreteDomain representing the (1D) original mesh.
+ *
+ * @return The initialized Impl representing the discrete cosine space.
+ */
+template <typename DDimKx, typename DDimX>
+typename DDimKx::template Impl<DDimKx, Kokkos::HostSpace> init_cosine_space(
+        ddc::DiscreteDomain<DDimX> x_mesh)
+{
+    static_assert(
+            std::is_same_v<
+                    typename DDimKx::continuous_dimension_type,
+                    ddc::Cosine<typename DDimX::continuous_dimension_type>>,
+            "DDimX and DDimKx dimensions must be defined over the same continuous dimension");
+    return detail::r2r::init_mode_space<DDimKx>(x_mesh, 0);
+}
+
+/**
+ * @brief Initialize a sine discrete dimension.
+ *
+ * Initialize the (1D) discrete space representing the modes of the DST-II of a discrete function
+ * defined on the (1D) cell-centered mesh passed as argument, ie. with homogeneous Dirichlet
+ * boundary conditions at half a cell from the first and last points. It is a UniformPointSampling
+ * with wavenumbers k_m = (m+1)*pi/L, m = 0..N-1, where L = N*dx is the length of the box.
+ *
+ * @tparam DDimKx A UniformPointSampling over ddc::Sine<CDimX> representing the sine discrete dimension.
+ * @tparam DDimX The type of the original discrete dimension.
+ *
+ * @param x_mesh The DiscreteDomain representing the (1D) original mesh.
+ *
+ * @return The initialized Impl representing the discrete sine space.
+ */
+template <typename DDimKx, typename DDimX>
+typename DDimKx::template Impl<DDimKx, Kokkos::HostSpace> init_sine_space(
+        ddc::DiscreteDomain<DDimX> x_mesh)
+{
+    static_assert(
+            std::is_same_v<
+                    typename DDimKx::continuous_dimension_type,
+                    ddc::Sine<typename DDimX::continuous_dimension_type>>,
+            "DDimX and DDimKx dimensions must be defined over the same continuous dimension");
+    return detail::r2r::init_mode_space<DDimKx>(x_mesh, 1);
+}
+
+/**
+ * @brief Get the mesh of the modes of a DCT or a DST.
+ *
+ * Real-to-real transforms keep the number of points. As for fourier_mesh, a DDimKx identical
+ * to the DDimX at the same position denotes a batch dimension.
+ *
+ * @param x_mesh The DiscreteDomain representing the original mesh.
+ *
+ * @return The domain representing the mesh of the modes.
+ */
+template <typename... DDimKx, typename... DDimX>
+ddc::DiscreteDomain<DDimKx...> r2r_mesh(ddc::DiscreteDomain<DDimX...> x_mesh)
+{
+    static_assert(
+            ((std::is_same_v<DDimX, DDimKx> || is_uniform_point_sampling_v<DDimX>) && ...),
+            "DDimX dimensions should derive from UniformPointSampling");
+    static_assert(
+            ((std::is_same_v<DDimX, DDimKx> || is_uniform_point_sampling_v<DDimKx>) && ...),
+            "DDimKx dimensions should derive from UniformPointSampling");
+    ddc::DiscreteVector<DDimX...> const extents = x_mesh.extents();
+    return ddc::DiscreteDomain<DDimKx...>(
+            detail::fft::fourier_mesh_1d<DDimKx, DDimX>(x_mesh, extents)...);
+}
+
+/**
+ * @brief Perform a discrete cosine transform (DCT-II).
+ *
+ * The transform is performed with FFTW on the host, along the dimensions which differ between
+ * `in` and `out`, the others are batch dimensions. Un-normalized, the DCT-II followed by the
+ * DCT-III (idct) multiplies the input by 2N per transformed dimension.
+ *
+ * @tparam Tin The type of the input elements (float or double, possibly const).
+ * @tparam Tout The type of the output elements (float or double).
+ * @tparam DDimKx... The parameter pack of the cosine discrete dimensions.
+ * @tparam DDimX... The parameter pack of the original discrete dimensions.
+ * @tparam ExecSpace The type of the Kokkos::ExecutionSpace used to synchronize and normalize.
+ * @tparam MemorySpace The type of the host accessible Kokkos::MemorySpace on which are stored the input and output discrete functions.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace used to synchronize and normalize.
+ * @param out The output discrete function, represented as a ChunkSpan storing values on the mode mesh.
+ * @param in The input discrete function, represented as a ChunkSpan storing values on a mesh.
+ * @param kwargs The kwArgs_fft configuring the DCT, only OFF, FORWARD and BACKWARD normalizations are supported.
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimKx,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename LayoutIn,
+        typename LayoutOut>
+void dct(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimKx...>, LayoutOut, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimX...>, LayoutIn, MemorySpace> in,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            std::is_same_v<LayoutIn, Kokkos::layout_right>
+                    && std::is_same_v<LayoutOut, Kokkos::layout_right>,
+            "Layouts must be right-handed");
+
+    detail::r2r::
+            impl(exec_space,
+                 in,
+                 out,
+                 detail::r2r::R2R_Kind::COSINE,
+                 ddc::FFT_Direction::FORWARD,
+                 kwargs.normalization);
+}
+
+/**
+ * @brief Perform an inverse discrete cosine transform (DCT-III).
+ *
+ * @see dct
+ *
+ * @param exec_space The Kokkos::ExecutionSpace used to synchronize and normalize.
+ * @param out The output discrete function, represented as a ChunkSpan storing values on a mesh.
+ * @param in The input discrete function, represented as a ChunkSpan storing values on the mode mesh.
+ * @param kwargs The kwArgs_fft configuring the inverse DCT, only OFF, FORWARD and BACKWARD normalizations are supported.
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimX,
+        typename... DDimKx,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename LayoutIn,
+        typename LayoutOut>
+void idct(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimX...>, LayoutOut, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimKx...>, LayoutIn, MemorySpace> in,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            std::is_same_v<LayoutIn, Kokkos::layout_right>
+                    && std::is_same_v<LayoutOut, Kokkos::layout_right>,
+            "Layouts must be right-handed");
+
+    detail::r2r::
+            impl(exec_space,
+                 in,
+                 out,
+                 detail::r2r::R2R_Kind::COSINE,
+                 ddc::FFT_Direction::BACKWARD,
+                 kwargs.normalization);
+}
+
+/**
+ * @brief Perform a discrete sine transform (DST-II).
+ *
+ * The transform is performed with FFTW on the host, along the dimensions which differ between
+ * `in` and `out`, the others are batch dimensions. Un-normalized, the DST-II followed by the
+ * DST-III (idst) multiplies the input by 2N per transformed dimension.
+ *
+ * @param exec_space The Kokkos::ExecutionSpace used to synchronize and normalize.
+ * @param out The output discrete function, represented as a ChunkSpan storing values on the mode mesh.
+ * @param in The input discrete function, represented as a ChunkSpan storing values on a mesh.
+ * @param kwargs The kwArgs_fft configuring the DST, only OFF, FORWARD and BACKWARD normalizations are supported.
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimKx,
+        typename... DDimX,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename LayoutIn,
+        typename LayoutOut>
+void dst(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimKx...>, LayoutOut, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimX...>, LayoutIn, MemorySpace> in,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            std::is_same_v<LayoutIn, Kokkos::layout_right>
+                    && std::is_same_v<LayoutOut, Kokkos::layout_right>,
+            "Layouts must be right-handed");
+
+    detail::r2r::
+            impl(exec_space,
+                 in,
+                 out,
+                 detail::r2r::R2R_Kind::SINE,
+                 ddc::FFT_Direction::FORWARD,
+                 kwargs.normalization);
+}
+
+/**
+ * @brief Perform an inverse discrete sine transform (DST-III).
+ *
+ * @see dst
+ *
+ * @param exec_space The Kokkos::ExecutionSpace used to synchronize and normalize.
+ * @param out The output discrete function, represented as a ChunkSpan storing values on a mesh.
+ * @param in The input discrete function, represented as a ChunkSpan storing values on the mode mesh.
+ * @param kwargs The kwArgs_fft configuring the inverse DST, only OFF, FORWARD and BACKWARD normalizations are supported.
+ */
+template <
+        typename Tin,
+        typename Tout,
+        typename... DDimX,
+        typename... DDimKx,
+        typename ExecSpace,
+        typename MemorySpace,
+        typename LayoutIn,
+        typename LayoutOut>
+void idst(
+        ExecSpace const& exec_space,
+        ddc::ChunkSpan<Tout, ddc::DiscreteDomain<DDimX...>, LayoutOut, MemorySpace> out,
+        ddc::ChunkSpan<Tin, ddc::DiscreteDomain<DDimKx...>, LayoutIn, MemorySpace> in,
+        ddc::kwArgs_fft kwargs = {ddc::FFT_Normalization::OFF})
+{
+    static_assert(
+            std::is_same_v<LayoutIn, Kokkos::layout_right>
+                    && std::is_same_v<LayoutOut, Kokkos::layout_right>,
+            "Layouts must be right-handed");
+
+    detail::r2r::
+            impl(exec_space,
+                 in,
+                 out,
+                 detail::r2r::R2R_Kind::SINE,
+                 ddc::FFT_Direction::BACKWARD,
+                 kwargs.normalization);
+}
+
+} // namespace ddc
+
+#endif
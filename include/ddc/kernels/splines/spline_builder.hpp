@@ -813,6 +813,14 @@ operator()(
                 Layout,
                 memory_space>> const derivs_xmax) const
 {
+    std::size_t const bytes_read = sizeof(double)
+                                   * (vals.size() + (derivs_xmin ? derivs_xmin->size() : 0)
+                                      + (derivs_xmax ? derivs_xmax->size() : 0));
+    ddc::detail::ScopedInstrumentation const instrumentation(
+            "ddc_splines_build",
+            exec_space(),
+            {vals.size(), sizeof(double), bytes_read, spline.size() * sizeof(double)});
+
     auto const batched_interpolation_domain = vals.domain();
 
     assert(interpolation_domain() == interpolation_domain_type(batched_interpolation_domain));
@@ -295,6 +295,15 @@ public:
                     Layout3,
                     memory_space> const spline_coef) const
     {
+        ddc::detail::ScopedInstrumentation const instrumentation(
+                "ddc_splines_evaluate",
+                exec_space(),
+                {spline_eval.size(),
+                 sizeof(double),
+                 spline_coef.size() * sizeof(double)
+                         + coords_eval.size() * sizeof(ddc::Coordinate<CoordsDims...>),
+                 spline_eval.size() * sizeof(double)});
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
@@ -342,6 +351,14 @@ public:
                     Layout2,
                     memory_space> const spline_coef) const
     {
+        ddc::detail::ScopedInstrumentation const instrumentation(
+                "ddc_splines_evaluate",
+                exec_space(),
+                {spline_eval.size(),
+                 sizeof(double),
+                 spline_coef.size() * sizeof(double),
+                 spline_eval.size() * sizeof(double)});
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
@@ -420,6 +437,15 @@ public:
                     Layout3,
                     memory_space> const spline_coef) const
     {
+        ddc::detail::ScopedInstrumentation const instrumentation(
+                "ddc_splines_differentiate",
+                exec_space(),
+                {spline_eval.size(),
+                 sizeof(double),
+                 spline_coef.size() * sizeof(double)
+                         + coords_eval.size() * sizeof(ddc::Coordinate<CoordsDims...>),
+                 spline_eval.size() * sizeof(double)});
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
@@ -464,6 +490,14 @@ public:
                     Layout2,
                     memory_space> const spline_coef) const
     {
+        ddc::detail::ScopedInstrumentation const instrumentation(
+                "ddc_splines_differentiate",
+                exec_space(),
+                {spline_eval.size(),
+                 sizeof(double),
+                 spline_coef.size() * sizeof(double),
+                 spline_eval.size() * sizeof(double)});
+
         evaluation_domain_type const evaluation_domain(spline_eval.domain());
         batch_domain_type<BatchedInterpolationDDom> const batch_domain(spline_eval.domain());
 
@@ -7,14 +7,20 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include <ginkgo/extensions/kokkos.hpp>
 #include <ginkgo/ginkgo.hpp>
 
+#include <ddc/ddc.hpp>
+
 #include <Kokkos_Core.hpp>
 
 #include "splines_linear_problem.hpp"
@@ -125,6 +131,36 @@ unsigned int default_preconditioner_max_block_size() noexcept
     return 1U;
 }
 
+/// The parameter cols_per_chunk declared to the tuning tools, see ddc::TuningContext.
+template <class ExecSpace>
+TunableParameter const& cols_per_chunk_parameter()
+{
+    static TunableParameter const
+            parameter("ddc_splines_cols_per_chunk",
+                      {256, 1024, 4096, 8192, 16384, 65535},
+                      default_cols_per_chunk<ExecSpace>());
+    return parameter;
+}
+
+/// The parameter preconditioner_max_block_size declared to the tuning tools, see ddc::autotune.
+template <class ExecSpace>
+TunableParameter const& preconditioner_max_block_size_parameter()
+{
+    static TunableParameter const
+            parameter("ddc_splines_preconditioner_max_block_size",
+                      {1, 2, 4, 8, 16, 32},
+                      default_preconditioner_max_block_size<ExecSpace>());
+    return parameter;
+}
+
+/// Shape of a sparse problem used as a key of the tuned parameters
+template <class ExecSpace>
+std::string sparse_problem_shape(std::size_t const mat_size, std::size_t const nrhs)
+{
+    return std::string(ExecSpace::name()) + "/n=" + std::to_string(mat_size)
+           + "/nrhs=" + std::to_string(nrhs);
+}
+
 /**
  * @brief A sparse linear problem dedicated to the computation of a spline approximation.
  *
@@ -159,61 +195,19 @@ private:
     std::shared_ptr<solver_type> m_solver;
     std::shared_ptr<gko::LinOp> m_solver_tr;
 
-    std::size_t m_cols_per_chunk; // Maximum number of columns of B to be passed to a Ginkgo solver
+    // Maximum number of columns of B to be passed to a Ginkgo solver, tuned when not given
+    std::optional<std::size_t> m_cols_per_chunk;
 
-    unsigned int m_preconditioner_max_block_size; // Maximum size of Jacobi-block preconditioner
+    // Tuned number of columns per chunk for each number of right-hand sides, once it is settled
+    mutable std::map<std::size_t, std::size_t> m_tuned_cols_per_chunk;
 
-public:
-    /**
-     * @brief SplinesLinearProblemSparse constructor.
-     *
-     * @param mat_size The size of one of the dimensions of the square matrix.
-     * @param cols_per_chunk An optional parameter used to define the number of right-hand sides to pass to
-     * Ginkgo solver calls. see default_cols_per_chunk.
-     * @param preconditioner_max_block_size An optional parameter used to define the maximum size of a block
-     * used by the block-Jacobi preconditioner. see default_preconditioner_max_block_size.
-     */
-    explicit SplinesLinearProblemSparse(
-            std::size_t const mat_size,
-            std::optional<std::size_t> cols_per_chunk = std::nullopt,
-            std::optional<unsigned int> preconditioner_max_block_size = std::nullopt)
-        : SplinesLinearProblem<ExecSpace>(mat_size)
-        , m_cols_per_chunk(cols_per_chunk.value_or(default_cols_per_chunk<ExecSpace>()))
-        , m_preconditioner_max_block_size(preconditioner_max_block_size.value_or(
-                  default_preconditioner_max_block_size<ExecSpace>()))
-    {
-        std::shared_ptr const gko_exec = gko::ext::kokkos::create_executor(ExecSpace());
-        m_matrix_dense = gko::matrix::Dense<
-                double>::create(gko_exec->get_master(), gko::dim<2>(mat_size, mat_size));
-        m_matrix_dense->fill(0);
-        m_matrix_sparse = matrix_sparse_type::create(gko_exec, gko::dim<2>(mat_size, mat_size));
-    }
+    mutable std::mutex m_tuned_cols_per_chunk_mutex;
 
-    double get_element(std::size_t i, std::size_t j) const override
-    {
-        return m_matrix_dense->at(i, j);
-    }
+    // Maximum size of Jacobi-block preconditioner, tuned when not given
+    std::optional<unsigned int> m_preconditioner_max_block_size;
 
-    void set_element(std::size_t i, std::size_t j, double aij) override
-    {
-        m_matrix_dense->at(i, j) = aij;
-    }
-
-    /**
-     * @brief Perform a pre-process operation on the solver. Must be called after filling the matrix.
-     *
-     * Removes the zeros from the CSR object and instantiate a Ginkgo solver. It also constructs a transposed version of the solver.
-     *
-     * The stopping criterion is a reduction factor ||Ax-b||/||b||<1e-15 with 1000 maximum iterations.
-     */
-    void setup_solver() override
+    void generate_solvers(unsigned int const preconditioner_max_block_size)
     {
-        // Remove zeros
-        gko::matrix_data<double> matrix_data(gko::dim<2>(size(), size()));
-        m_matrix_dense->write(matrix_data);
-        m_matrix_dense.reset();
-        matrix_data.remove_zeros();
-        m_matrix_sparse->read(matrix_data);
         std::shared_ptr const gko_exec = m_matrix_sparse->get_executor();
 
         // Create the solver factory
@@ -226,7 +220,7 @@ public:
 
         std::shared_ptr const preconditioner
                 = gko::preconditioner::Jacobi<double>::build()
-                          .with_max_block_size(m_preconditioner_max_block_size)
+                          .with_max_block_size(preconditioner_max_block_size)
                           .on(gko_exec);
 
         std::unique_ptr const solver_factory
@@ -240,24 +234,13 @@ public:
         gko_exec->synchronize();
     }
 
-    /**
-     * @brief Solve the multiple right-hand sides linear problem Ax=b or its transposed version A^tx=b inplace.
-     *
-     * The solver method is currently Bicgstab on CPU Serial and GPU and Gmres on OMP (because of Ginkgo issue #1563).
-     *
-     * Multiple right-hand sides are sliced in chunks of size cols_per_chunk which are passed one-after-the-other to Ginkgo.
-     *
-     * @param[in, out] b A 2D Kokkos::View storing the multiple right-hand sides of the problem and receiving the corresponding solution.
-     * @param transpose Choose between the direct or transposed version of the linear problem.
-     */
-    void solve(MultiRHS const b, bool const transpose) const override
+    void solve_by_chunks(MultiRHS const b, bool const transpose, std::size_t const cols_per_chunk)
+            const
     {
-        assert(b.extent(0) == size());
-
         std::shared_ptr const gko_exec = m_solver->get_executor();
         std::shared_ptr const convergence_logger = gko::log::Convergence<double>::create();
 
-        std::size_t const main_chunk_size = std::min(m_cols_per_chunk, b.extent(1));
+        std::size_t const main_chunk_size = std::min(cols_per_chunk, b.extent(1));
 
         Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> const
                 b_buffer("ddc_sparse_b_buffer", size(), main_chunk_size);
@@ -306,6 +289,137 @@ public:
             Kokkos::deep_copy(b_chunk, x_chunk);
         }
     }
+
+public:
+    /**
+     * @brief SplinesLinearProblemSparse constructor.
+     *
+     * @param mat_size The size of one of the dimensions of the square matrix.
+     * @param cols_per_chunk An optional parameter used to define the number of right-hand sides to pass to
+     * Ginkgo solver calls. When not given, it is tuned per problem shape, see ddc::TuningContext and
+     * default_cols_per_chunk.
+     * @param preconditioner_max_block_size An optional parameter used to define the maximum size of a block
+     * used by the block-Jacobi preconditioner. When not given, it is read from the tuning cache filled
+     * by ddc::autotune, see default_preconditioner_max_block_size.
+     */
+    explicit SplinesLinearProblemSparse(
+            std::size_t const mat_size,
+            std::optional<std::size_t> cols_per_chunk = std::nullopt,
+            std::optional<unsigned int> preconditioner_max_block_size = std::nullopt)
+        : SplinesLinearProblem<ExecSpace>(mat_size)
+        , m_cols_per_chunk(cols_per_chunk)
+        , m_preconditioner_max_block_size(preconditioner_max_block_size)
+    {
+        std::shared_ptr const gko_exec = gko::ext::kokkos::create_executor(ExecSpace());
+        m_matrix_dense = gko::matrix::Dense<
+                double>::create(gko_exec->get_master(), gko::dim<2>(mat_size, mat_size));
+        m_matrix_dense->fill(0);
+        m_matrix_sparse = matrix_sparse_type::create(gko_exec, gko::dim<2>(mat_size, mat_size));
+    }
+
+    double get_element(std::size_t i, std::size_t j) const override
+    {
+        return m_matrix_dense->at(i, j);
+    }
+
+    void set_element(std::size_t i, std::size_t j, double aij) override
+    {
+        m_matrix_dense->at(i, j) = aij;
+    }
+
+    /**
+     * @brief Perform a pre-process operation on the solver. Must be called after filling the matrix.
+     *
+     * Removes the zeros from the CSR object and instantiate a Ginkgo solver. It also constructs a transposed version of the solver.
+     *
+     * The stopping criterion is a reduction factor ||Ax-b||/||b||<1e-15 with 1000 maximum iterations.
+     */
+    void setup_solver() override
+    {
+        // Remove zeros
+        gko::matrix_data<double> matrix_data(gko::dim<2>(size(), size()));
+        m_matrix_dense->write(matrix_data);
+        m_matrix_dense.reset();
+        matrix_data.remove_zeros();
+        m_matrix_sparse->read(matrix_data);
+
+        if (m_preconditioner_max_block_size) {
+            generate_solvers(*m_preconditioner_max_block_size);
+            return;
+        }
+        TunableParameter const& parameter = preconditioner_max_block_size_parameter<ExecSpace>();
+        std::string const shape = sparse_problem_shape<ExecSpace>(size(), 1);
+        std::optional<std::int64_t> block_size = tuned_value(parameter, shape);
+        if (!block_size && is_autotune_enabled()) {
+            // The preconditioner is timed on the solve of a single right-hand side
+            MultiRHS const b("ddc_sparse_autotune_b", size(), 1);
+            block_size = autotune(ExecSpace(), parameter, shape, [&](std::int64_t const value) {
+                generate_solvers(static_cast<unsigned int>(value));
+                Kokkos::deep_copy(b, 1.);
+                solve_by_chunks(b, false, 1);
+            });
+        }
+        generate_solvers(
+                static_cast<unsigned int>(block_size.value_or(parameter.default_value())));
+    }
+
+    /**
+     * @brief Solve the multiple right-hand sides linear problem Ax=b or its transposed version A^tx=b inplace.
+     *
+     * The solver method is currently Bicgstab on CPU Serial and GPU and Gmres on OMP (because of Ginkgo issue #1563).
+     *
+     * Multiple right-hand sides are sliced in chunks of size cols_per_chunk which are passed one-after-the-other to Ginkgo.
+     *
+     * @param[in, out] b A 2D Kokkos::View storing the multiple right-hand sides of the problem and receiving the corresponding solution.
+     * @param transpose Choose between the direct or transposed version of the linear problem.
+     */
+    void solve(MultiRHS const b, bool const transpose) const override
+    {
+        assert(b.extent(0) == size());
+
+        if (m_cols_per_chunk) {
+            solve_by_chunks(b, transpose, *m_cols_per_chunk);
+            return;
+        }
+        std::size_t const nrhs = b.extent(1);
+        std::optional<std::size_t> cols_per_chunk;
+        {
+            std::lock_guard<std::mutex> const lock(m_tuned_cols_per_chunk_mutex);
+            auto const it = m_tuned_cols_per_chunk.find(nrhs);
+            if (it != m_tuned_cols_per_chunk.end()) {
+                cols_per_chunk = it->second;
+            }
+        }
+        if (cols_per_chunk) {
+            solve_by_chunks(b, transpose, *cols_per_chunk);
+            return;
+        }
+
+        TunableParameter const& parameter = cols_per_chunk_parameter<ExecSpace>();
+        std::string const shape = sparse_problem_shape<ExecSpace>(size(), nrhs);
+        if (is_autotune_enabled() && !tuned_value(parameter, shape)) {
+            MultiRHS const b_copy("ddc_sparse_autotune_b", b.extent(0), b.extent(1));
+            autotune(ExecSpace(), parameter, shape, [&](std::int64_t const value) {
+                Kokkos::deep_copy(b_copy, b);
+                solve_by_chunks(b_copy, transpose, static_cast<std::size_t>(value));
+            });
+        }
+        // The value is settled unless a Kokkos tuning tool has to be asked at each solve
+        std::optional<std::int64_t> value = tuned_value(parameter, shape);
+        if (!value && !Kokkos::Tools::Experimental::have_tuning_tool()) {
+            value = parameter.default_value();
+        }
+        if (value) {
+            {
+                std::lock_guard<std::mutex> const lock(m_tuned_cols_per_chunk_mutex);
+                m_tuned_cols_per_chunk.emplace(nrhs, static_cast<std::size_t>(*value));
+            }
+            solve_by_chunks(b, transpose, static_cast<std::size_t>(*value));
+            return;
+        }
+        TuningContext const context(parameter, shape);
+        solve_by_chunks(b, transpose, static_cast<std::size_t>(context.value()));
+    }
 };
 
 } // namespace ddc::detail
@@ -10,6 +10,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "memory_tracker.hpp"
+
 namespace ddc {
 
 template <class T, class MemorySpace>
@@ -56,16 +58,23 @@ public:
 
     [[nodiscard]] T* allocate(std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(sizeof(T) * n));
+        return allocate("no-label", n);
     }
 
     [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        T* const p = static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        if (detail::g_memory_tracker) {
+            detail::g_memory_tracker->allocate(p, label, MemorySpace::name(), sizeof(T) * n);
+        }
+        return p;
     }
 
     void deallocate(T* p, std::size_t) const
     {
+        if (detail::g_memory_tracker) {
+            detail::g_memory_tracker->deallocate(p);
+        }
         Kokkos::kokkos_free(p);
     }
 };
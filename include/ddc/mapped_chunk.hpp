@@ -0,0 +1,279 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/memory_mapping.hpp"
+
+#include "chunk_span.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_vector.hpp"
+
+namespace ddc {
+
+/// Access pattern hint given to the kernel for the pages of a `MappedChunk`
+enum class MappedChunkAdvice { NORMAL, SEQUENTIAL, RANDOM };
+
+namespace detail {
+
+/** Fixed-size part of the header of a mapped chunk file.
+ *
+ * It is followed by `rank` pairs of 64-bit unsigned integers holding the front uid and the
+ * extent of each dimension. The data starts at `data_offset`, a multiple of the page size,
+ * and is stored in row-major order.
+ */
+struct MappedChunkHeader
+{
+    static constexpr char s_magic[8] = {'D', 'D', 'C', 'C', 'H', 'U', 'N', 'K'};
+
+    static constexpr std::uint32_t s_version = 1;
+
+    static constexpr std::size_t s_data_alignment = 4096;
+
+    char magic[8];
+
+    std::uint32_t version;
+
+    std::uint32_t rank;
+
+    std::uint64_t element_size;
+
+    std::uint64_t data_offset;
+};
+
+inline constexpr std::size_t mapped_chunk_data_offset(std::size_t const rank) noexcept
+{
+    std::size_t const header_size = sizeof(MappedChunkHeader) + 2 * rank * sizeof(std::uint64_t);
+    return (header_size + MappedChunkHeader::s_data_alignment - 1)
+           / MappedChunkHeader::s_data_alignment * MappedChunkHeader::s_data_alignment;
+}
+
+inline int to_posix_madvise(MappedChunkAdvice const advice)
+{
+    switch (advice) {
+    case MappedChunkAdvice::SEQUENTIAL:
+        return POSIX_MADV_SEQUENTIAL;
+    case MappedChunkAdvice::RANDOM:
+        return POSIX_MADV_RANDOM;
+    default:
+        return POSIX_MADV_NORMAL;
+    }
+}
+
+} // namespace detail
+
+/** A `ChunkSpan` factory backed by a memory-mapped file.
+ *
+ * The file starts with a small header describing the domain and is followed by the data.
+ * Pages are loaded lazily by the operating system, so the data can be larger than the
+ * physical memory. A `MappedChunk` with a const `ElementType` maps the file read-only,
+ * otherwise the mapping is read-write and modifications are written back to the file.
+ *
+ * This is only available on POSIX systems.
+ */
+template <class ElementType, class SupportType>
+class MappedChunk
+{
+    static_assert(
+            std::is_trivially_copyable_v<std::remove_const_t<ElementType>>,
+            "Only trivially copyable types can be stored in a mapped file");
+
+public:
+    /// type of a span of this full chunk
+    using span_type = ChunkSpan<ElementType, SupportType, Kokkos::layout_right, Kokkos::HostSpace>;
+
+    /// type of a view of this full chunk
+    using view_type
+            = ChunkSpan<ElementType const, SupportType, Kokkos::layout_right, Kokkos::HostSpace>;
+
+    using discrete_domain_type = SupportType;
+
+    using memory_space = Kokkos::HostSpace;
+
+    using element_type = ElementType;
+
+    static constexpr bool is_writable = !std::is_const_v<ElementType>;
+
+private:
+    detail::MemoryMapping m_mapping;
+
+    span_type m_span;
+
+    MappedChunk(
+            detail::MemoryMapping&& mapping,
+            std::size_t const data_offset,
+            SupportType const& domain)
+        : m_mapping(std::move(mapping))
+        , m_span(reinterpret_cast<ElementType*>(m_mapping.data() + data_offset), domain)
+    {
+    }
+
+public:
+    /** Create (or truncate) the file `path` and map it read-write
+     * @param path the path of the file
+     * @param domain the domain of the chunk
+     * @param advice the expected access pattern
+     */
+    static MappedChunk create(
+            std::string const& path,
+            SupportType const& domain,
+            MappedChunkAdvice const advice = MappedChunkAdvice::NORMAL)
+    {
+        static_assert(is_writable, "Cannot create a read-only mapped chunk");
+        detail::FileDescriptor const fd(::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+        if (fd.get() == -1) {
+            throw detail::system_error("Cannot create " + path, errno);
+        }
+        std::size_t const data_offset = detail::mapped_chunk_data_offset(SupportType::rank());
+        std::size_t const file_size = data_offset + domain.size() * sizeof(ElementType);
+        fd.resize(file_size);
+        detail::MemoryMapping mapping(fd.get(), file_size, true);
+
+        detail::MappedChunkHeader header;
+        std::memcpy(header.magic, detail::MappedChunkHeader::s_magic, sizeof(header.magic));
+        header.version = detail::MappedChunkHeader::s_version;
+        header.rank = SupportType::rank();
+        header.element_size = sizeof(ElementType);
+        header.data_offset = data_offset;
+        std::memcpy(mapping.data(), &header, sizeof(header));
+        std::byte* const dims = mapping.data() + sizeof(header);
+        auto const front = domain.front();
+        auto const extents = domain.extents();
+        for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+            std::uint64_t const dim[2]
+                    = {static_cast<std::uint64_t>(detail::array(front)[i]),
+                       static_cast<std::uint64_t>(detail::array(extents)[i])};
+            std::memcpy(dims + i * sizeof(dim), dim, sizeof(dim));
+        }
+
+        MappedChunk chunk(std::move(mapping), data_offset, domain);
+        chunk.advise(advice);
+        return chunk;
+    }
+
+    /** Map an existing file previously created with `MappedChunk::create`
+     * @param path the path of the file
+     * @param advice the expected access pattern
+     */
+    static MappedChunk open(
+            std::string const& path,
+            MappedChunkAdvice const advice = MappedChunkAdvice::NORMAL)
+    {
+        detail::FileDescriptor const fd(::open(path.c_str(), is_writable ? O_RDWR : O_RDONLY));
+        if (fd.get() == -1) {
+            throw detail::system_error("Cannot open " + path, errno);
+        }
+        std::size_t const file_size = fd.file_size();
+        if (file_size < detail::mapped_chunk_data_offset(SupportType::rank())) {
+            throw std::runtime_error(path + " is not a mapped chunk file");
+        }
+        detail::MemoryMapping mapping(fd.get(), file_size, is_writable);
+
+        detail::MappedChunkHeader header;
+        std::memcpy(&header, mapping.data(), sizeof(header));
+        if (std::memcmp(header.magic, detail::MappedChunkHeader::s_magic, sizeof(header.magic))
+            != 0) {
+            throw std::runtime_error(path + " is not a mapped chunk file");
+        }
+        if (header.version != detail::MappedChunkHeader::s_version) {
+            throw std::runtime_error(path + ": unsupported mapped chunk version");
+        }
+        if (header.rank != SupportType::rank()) {
+            throw std::runtime_error(path + ": rank mismatch");
+        }
+        if (header.element_size != sizeof(ElementType)) {
+            throw std::runtime_error(path + ": element size mismatch");
+        }
+
+        typename SupportType::discrete_element_type front;
+        typename SupportType::discrete_vector_type extents;
+        std::byte const* const dims = mapping.data() + sizeof(header);
+        for (std::size_t i = 0; i < SupportType::rank(); ++i) {
+            std::uint64_t dim[2];
+            std::memcpy(dim, dims + i * sizeof(dim), sizeof(dim));
+            detail::array(front)[i] = dim[0];
+            detail::array(extents)[i] = dim[1];
+        }
+        SupportType const domain(front, extents);
+        if (header.data_offset % alignof(ElementType) != 0
+            || file_size < header.data_offset + domain.size() * sizeof(ElementType)) {
+            throw std::runtime_error(path + ": truncated mapped chunk file");
+        }
+
+        MappedChunk chunk(std::move(mapping), header.data_offset, domain);
+        chunk.advise(advice);
+        return chunk;
+    }
+
+    MappedChunk(MappedChunk const& other) = delete;
+
+    MappedChunk(MappedChunk&& other) noexcept
+        : m_mapping(std::move(other.m_mapping))
+        , m_span(std::exchange(other.m_span, span_type()))
+    {
+    }
+
+    ~MappedChunk() = default;
+
+    MappedChunk& operator=(MappedChunk const& other) = delete;
+
+    MappedChunk& operator=(MappedChunk&& other) noexcept
+    {
+        m_mapping = std::move(other.m_mapping);
+        m_span = std::exchange(other.m_span, span_type());
+        return *this;
+    }
+
+    SupportType domain() const noexcept
+    {
+        return m_span.domain();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_span.size();
+    }
+
+    ElementType* data_handle() const noexcept
+    {
+        return m_span.data_handle();
+    }
+
+    view_type span_cview() const
+    {
+        return view_type(m_span);
+    }
+
+    span_type span_view() const
+    {
+        return m_span;
+    }
+
+    /// Update the access pattern hint of the whole mapping
+    void advise(MappedChunkAdvice const advice) const
+    {
+        m_mapping.advise(detail::to_posix_madvise(advice));
+    }
+
+    /// Synchronously write back the modified data to the file
+    void flush() const
+    {
+        if constexpr (is_writable) {
+            m_mapping.sync();
+        }
+    }
+};
+
+} // namespace ddc
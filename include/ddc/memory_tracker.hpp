@@ -0,0 +1,194 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace ddc {
+
+/// Memory usage of the allocations made through DDC allocators
+struct MemoryUsage
+{
+    /// number of bytes currently allocated
+    std::size_t current_bytes = 0;
+
+    /// largest number of bytes allocated at the same time since the last reset
+    std::size_t peak_bytes = 0;
+
+    /// number of allocations since the last reset
+    std::size_t allocation_count = 0;
+};
+
+namespace detail {
+
+class MemoryTracker
+{
+    struct Allocation
+    {
+        std::string label;
+
+        std::string memory_space;
+
+        std::size_t bytes;
+    };
+
+    mutable std::mutex m_mutex;
+
+    std::unordered_map<void const*, Allocation> m_allocations;
+
+    MemoryUsage m_total;
+
+    std::map<std::string, MemoryUsage> m_per_label;
+
+    std::map<std::string, MemoryUsage> m_per_memory_space;
+
+    static void add(MemoryUsage& usage, std::size_t const bytes) noexcept
+    {
+        usage.current_bytes += bytes;
+        usage.peak_bytes = std::max(usage.peak_bytes, usage.current_bytes);
+        ++usage.allocation_count;
+    }
+
+    static void remove(MemoryUsage& usage, std::size_t const bytes) noexcept
+    {
+        usage.current_bytes -= bytes;
+    }
+
+    static void reset_peak(MemoryUsage& usage) noexcept
+    {
+        usage.peak_bytes = usage.current_bytes;
+        usage.allocation_count = 0;
+    }
+
+public:
+    void allocate(
+            void const* const ptr,
+            std::string const& label,
+            std::string const& memory_space,
+            std::size_t const bytes)
+    {
+        std::lock_guard const lock(m_mutex);
+        m_allocations[ptr] = Allocation {label, memory_space, bytes};
+        add(m_total, bytes);
+        add(m_per_label[label], bytes);
+        add(m_per_memory_space[memory_space], bytes);
+    }
+
+    void deallocate(void const* const ptr)
+    {
+        std::lock_guard const lock(m_mutex);
+        auto const it = m_allocations.find(ptr);
+        // Allocations made before the tracker was initialized are ignored
+        if (it == m_allocations.end()) {
+            return;
+        }
+        Allocation const& allocation = it->second;
+        remove(m_total, allocation.bytes);
+        remove(m_per_label[allocation.label], allocation.bytes);
+        remove(m_per_memory_space[allocation.memory_space], allocation.bytes);
+        m_allocations.erase(it);
+    }
+
+    MemoryUsage total() const
+    {
+        std::lock_guard const lock(m_mutex);
+        return m_total;
+    }
+
+    std::map<std::string, MemoryUsage> per_label() const
+    {
+        std::lock_guard const lock(m_mutex);
+        return m_per_label;
+    }
+
+    std::map<std::string, MemoryUsage> per_memory_space() const
+    {
+        std::lock_guard const lock(m_mutex);
+        return m_per_memory_space;
+    }
+
+    void reset_peaks()
+    {
+        std::lock_guard const lock(m_mutex);
+        reset_peak(m_total);
+        for (auto& [label, usage] : m_per_label) {
+            reset_peak(usage);
+        }
+        for (auto& [memory_space, usage] : m_per_memory_space) {
+            reset_peak(usage);
+        }
+    }
+};
+
+// Global CPU variable tracking the allocations made through `KokkosAllocator`,
+// initialized by `ScopeGuard`
+inline std::optional<MemoryTracker> g_memory_tracker;
+
+} // namespace detail
+
+/// @return the memory usage of all tracked allocations
+inline MemoryUsage memory_usage()
+{
+    if (!detail::g_memory_tracker) {
+        return MemoryUsage();
+    }
+    return detail::g_memory_tracker->total();
+}
+
+/// @return the memory usage of tracked allocations grouped by label
+inline std::map<std::string, MemoryUsage> memory_usage_per_label()
+{
+    if (!detail::g_memory_tracker) {
+        return {};
+    }
+    return detail::g_memory_tracker->per_label();
+}
+
+/// @return the memory usage of tracked allocations grouped by Kokkos memory space name
+inline std::map<std::string, MemoryUsage> memory_usage_per_memory_space()
+{
+    if (!detail::g_memory_tracker) {
+        return {};
+    }
+    return detail::g_memory_tracker->per_memory_space();
+}
+
+/// Set the peaks to the current usages and the allocation counts to zero
+inline void reset_memory_usage_peaks()
+{
+    if (detail::g_memory_tracker) {
+        detail::g_memory_tracker->reset_peaks();
+    }
+}
+
+/// Print a summary of the tracked memory usage
+inline std::ostream& print_memory_usage(std::ostream& os)
+{
+    auto const print_usage = [&os](std::string const& name, MemoryUsage const& usage) {
+        os << " - " << name << ": current=" << usage.current_bytes
+           << " B, peak=" << usage.peak_bytes << " B, allocations=" << usage.allocation_count
+           << '\n';
+    };
+    os << "DDC memory usage:\n";
+    print_usage("total", memory_usage());
+    os << "Per memory space:\n";
+    for (auto const& [memory_space, usage] : memory_usage_per_memory_space()) {
+        print_usage(memory_space, usage);
+    }
+    os << "Per label:\n";
+    for (auto const& [label, usage] : memory_usage_per_label()) {
+        print_usage(label, usage);
+    }
+    return os;
+}
+
+} // namespace ddc
@@ -5,10 +5,13 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <type_traits>
 
 #include <Kokkos_Core.hpp>
 
+#include "detail/instrumentation.hpp"
+
 #include "chunk_traits.hpp"
 
 namespace ddc {
@@ -28,6 +31,14 @@ auto parallel_deepcopy(ChunkDst&& dst, ChunkSrc&& src)
             "Not assignable");
     static_assert(std::is_same_v<decltype(dst.domain()), decltype(src.domain())>);
     assert(dst.domain() == src.domain());
+    std::size_t const element_size = sizeof(chunk_value_t<ChunkDst>);
+    detail::ScopedInstrumentation const instrumentation(
+            "ddc_parallel_deepcopy",
+            Kokkos::DefaultExecutionSpace(),
+            {dst.size(),
+             element_size,
+             src.size() * sizeof(chunk_value_t<ChunkSrc>),
+             dst.size() * element_size});
     Kokkos::deep_copy(dst.allocation_kokkos_view(), src.allocation_kokkos_view());
     return dst.span_view();
 }
@@ -50,6 +61,14 @@ auto parallel_deepcopy(ExecSpace const& execution_space, ChunkDst&& dst, ChunkSr
             std::is_same_v<decltype(dst.domain()), decltype(src.domain())>,
             "ddc::parallel_deepcopy only supports domains whose dimensions are of the same order");
     assert(dst.domain() == src.domain());
+    std::size_t const element_size = sizeof(chunk_value_t<ChunkDst>);
+    detail::ScopedInstrumentation const instrumentation(
+            "ddc_parallel_deepcopy",
+            execution_space,
+            {dst.size(),
+             element_size,
+             src.size() * sizeof(chunk_value_t<ChunkSrc>),
+             dst.size() * element_size});
     Kokkos::deep_copy(execution_space, dst.allocation_kokkos_view(), src.allocation_kokkos_view());
     return dst.span_view();
 }
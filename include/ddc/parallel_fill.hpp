@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include <Kokkos_Core.hpp>
 
+#include "detail/instrumentation.hpp"
+
 #include "chunk_traits.hpp"
 
 namespace ddc {
@@ -22,6 +25,11 @@ auto parallel_fill(ChunkDst&& dst, T const& value)
 {
     static_assert(is_borrowed_chunk_v<ChunkDst>);
     static_assert(std::is_assignable_v<chunk_reference_t<ChunkDst>, T>, "Not assignable");
+    std::size_t const element_size = sizeof(chunk_value_t<ChunkDst>);
+    detail::ScopedInstrumentation const instrumentation(
+            "ddc_parallel_fill",
+            Kokkos::DefaultExecutionSpace(),
+            {dst.size(), element_size, 0, dst.size() * element_size});
     Kokkos::deep_copy(dst.allocation_kokkos_view(), value);
     return dst.span_view();
 }
@@ -37,6 +45,11 @@ auto parallel_fill(ExecSpace const& execution_space, ChunkDst&& dst, T const& va
 {
     static_assert(is_borrowed_chunk_v<ChunkDst>);
     static_assert(std::is_assignable_v<chunk_reference_t<ChunkDst>, T>, "Not assignable");
+    std::size_t const element_size = sizeof(chunk_value_t<ChunkDst>);
+    detail::ScopedInstrumentation const instrumentation(
+            "ddc_parallel_fill",
+            execution_space,
+            {dst.size(), element_size, 0, dst.size() * element_size});
     Kokkos::deep_copy(execution_space, dst.allocation_kokkos_view(), value);
     return dst.span_view();
 }
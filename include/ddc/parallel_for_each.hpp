@@ -11,6 +11,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "detail/instrumentation.hpp"
 #include "detail/kokkos.hpp"
 
 #include "ddc_to_kokkos_execution_policy.hpp"
@@ -61,6 +62,7 @@ void for_each_kokkos(
         Support const& domain,
         Functor const& f) noexcept
 {
+    ScopedInstrumentation const instrumentation(label, execution_space, {domain.size()});
     Kokkos::parallel_for(
             label,
             ddc_to_kokkos_execution_policy(execution_space, domain),
@@ -11,6 +11,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "detail/instrumentation.hpp"
 #include "detail/kokkos.hpp"
 
 #include "ddc_to_kokkos_execution_policy.hpp"
@@ -146,6 +147,8 @@ T transform_reduce_kokkos(
         BinaryReductionOp const& reduce,
         UnaryTransformOp const& transform) noexcept
 {
+    ScopedInstrumentation const
+            instrumentation(label, execution_space, {domain.size(), sizeof(T)});
     T result = neutral;
     Kokkos::parallel_reduce(
             label,
@@ -4,15 +4,26 @@
 
 #pragma once
 
+#include <algorithm>
 #include <any>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
 #include <list>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <ddc/ddc.hpp>
 
+#include <Kokkos_Core.hpp>
+
 #include <pdi.h>
 
 namespace ddc {
@@ -26,6 +37,29 @@ static constexpr PDI_inout_t default_access_v
 template <class T>
 static constexpr PDI_inout_t chunk_default_access_v = is_writable_chunk_v<T> ? PDI_INOUT : PDI_OUT;
 
+namespace detail {
+
+/// Strides in number of elements of the chunk memory layout, from the outermost dimension
+template <class BorrowedChunk>
+std::vector<std::size_t> pdi_strides(BorrowedChunk const& data)
+{
+    auto const allocation_mdspan = data.allocation_mdspan();
+    std::vector<std::size_t> strides(allocation_mdspan.rank());
+    for (std::size_t i = 0; i < strides.size(); ++i) {
+        strides[i] = allocation_mdspan.stride(i);
+    }
+    return strides;
+}
+
+} // namespace detail
+
+/**
+ * An event sharing data with PDI, borrowed chunks are exposed as `name` along with the
+ * metadata `name_rank`, `name_extents`, `name_strides` and `name_start`.
+ *
+ * `name` points to the first element of the chunk and the strides, in number of elements, allow
+ * to expose any layout, e.g. a subdomain or a slice of a chunk, without packing copy.
+ */
 class PdiEvent
 {
     std::string m_event_name;
@@ -90,11 +124,17 @@ public:
                 !(access & PDI_IN) || (chunk_default_access_v<BorrowedChunk> & PDI_IN),
                 "Invalid access for constant data");
         std::array const extents = detail::array(data.domain().extents());
+        std::array const start = detail::array(data.domain().front());
         PDI_share(store_name(name + "_rank"), store_scalar(extents.size()), PDI_OUT);
         PDI_share(
                 store_name(name + "_extents"),
                 store_array(std::vector<std::size_t>(extents.begin(), extents.end())),
                 PDI_OUT);
+        PDI_share(store_name(name + "_strides"), store_array(detail::pdi_strides(data)), PDI_OUT);
+        PDI_share(
+                store_name(name + "_start"),
+                store_array(std::vector<std::size_t>(start.begin(), start.end())),
+                PDI_OUT);
         PDI_share(
                 store_name(name),
                 const_cast<chunk_value_t<BorrowedChunk>*>(data.data_handle()),
@@ -144,6 +184,342 @@ public:
     /// @}
 };
 
+/**
+ * An event whose names and metadata are registered once and re-armed at each output step.
+ *
+ * Contrary to PdiEvent, no string is built and no metadata is allocated when the event is
+ * triggered: `arm` only records the new data pointer (and the extents for chunks) in the slot
+ * returned by `add_chunk` or `add_scalar`. All the slots must be armed before `trigger`, the data
+ * being shared, the event fired and the data reclaimed in a single call.
+ */
+class PersistentPdiEvent
+{
+    struct Slot
+    {
+        std::string name;
+
+        std::string rank_name;
+
+        std::string extents_name;
+
+        PDI_inout_t access;
+
+        std::size_t rank;
+
+        std::string strides_name;
+
+        std::string start_name;
+
+        std::vector<std::size_t> extents;
+
+        std::vector<std::size_t> strides;
+
+        std::vector<std::size_t> start;
+
+        void* data;
+    };
+
+    std::string m_event_name;
+
+    std::vector<Slot> m_slots;
+
+    Slot& slot_at(std::size_t const slot)
+    {
+        if (slot >= m_slots.size()) {
+            throw std::runtime_error("Unknown slot in PersistentPdiEvent");
+        }
+        return m_slots[slot];
+    }
+
+public:
+    explicit PersistentPdiEvent(std::string event_name) : m_event_name(std::move(event_name)) {}
+
+    PersistentPdiEvent(PersistentPdiEvent const& rhs) = delete;
+
+    PersistentPdiEvent(PersistentPdiEvent&& rhs) noexcept = default;
+
+    ~PersistentPdiEvent() noexcept = default;
+
+    PersistentPdiEvent& operator=(PersistentPdiEvent const& rhs) = delete;
+
+    PersistentPdiEvent& operator=(PersistentPdiEvent&& rhs) noexcept = default;
+
+    /// Registers a chunk of the given rank, exposed with the same metadata as in PdiEvent
+    template <PDI_inout_t access = PDI_OUT>
+    std::size_t add_chunk(std::string const& name, std::size_t const rank)
+    {
+        m_slots.push_back(
+                Slot {name,
+                      name + "_rank",
+                      name + "_extents",
+                      access,
+                      rank,
+                      name + "_strides",
+                      name + "_start",
+                      std::vector<std::size_t>(rank),
+                      std::vector<std::size_t>(rank),
+                      std::vector<std::size_t>(rank),
+                      nullptr});
+        return m_slots.size() - 1;
+    }
+
+    /// Registers an arithmetic value exposed as `name`
+    template <PDI_inout_t access = PDI_OUT>
+    std::size_t add_scalar(std::string const& name)
+    {
+        m_slots.push_back(Slot {name, {}, {}, access, 0, {}, {}, {}, {}, {}, nullptr});
+        return m_slots.size() - 1;
+    }
+
+    /// Binds a borrowed chunk to a slot registered with `add_chunk`, without allocation
+    template <class BorrowedChunk, std::enable_if_t<is_borrowed_chunk_v<BorrowedChunk>, int> = 0>
+    PersistentPdiEvent& arm(std::size_t const slot, BorrowedChunk&& data)
+    {
+        Slot& s = slot_at(slot);
+        std::array const extents = detail::array(data.domain().extents());
+        if (s.rank_name.empty() || extents.size() != s.rank) {
+            throw std::runtime_error("Chunk rank does not match the registered one");
+        }
+        if ((s.access & PDI_IN) && !(chunk_default_access_v<BorrowedChunk> & PDI_IN)) {
+            throw std::runtime_error("Invalid access for constant data");
+        }
+        std::array const start = detail::array(data.domain().front());
+        auto const allocation_mdspan = data.allocation_mdspan();
+        std::copy(extents.begin(), extents.end(), s.extents.begin());
+        std::copy(start.begin(), start.end(), s.start.begin());
+        for (std::size_t i = 0; i < s.rank; ++i) {
+            s.strides[i] = allocation_mdspan.stride(i);
+        }
+        s.data = const_cast<chunk_value_t<BorrowedChunk>*>(data.data_handle());
+        return *this;
+    }
+
+    /// Binds an arithmetic value to a slot registered with `add_scalar`, it must outlive `trigger`
+    template <class Arithmetic, std::enable_if_t<std::is_arithmetic_v<Arithmetic>, int> = 0>
+    PersistentPdiEvent& arm(std::size_t const slot, Arithmetic& data)
+    {
+        Slot& s = slot_at(slot);
+        if (!s.rank_name.empty()) {
+            throw std::runtime_error("A scalar cannot be bound to a chunk slot");
+        }
+        if ((s.access & PDI_IN) && std::is_const_v<Arithmetic>) {
+            throw std::runtime_error("Invalid access for constant data");
+        }
+        s.data = const_cast<std::remove_cv_t<Arithmetic>*>(&data);
+        return *this;
+    }
+
+    /// Shares all the armed slots, fires the event and reclaims the data
+    void trigger()
+    {
+        for (Slot const& s : m_slots) {
+            if (s.data == nullptr) {
+                throw std::runtime_error("PersistentPdiEvent triggered with an unarmed slot");
+            }
+        }
+        for (Slot& s : m_slots) {
+            if (!s.rank_name.empty()) {
+                PDI_share(s.rank_name.c_str(), &s.rank, PDI_OUT);
+                PDI_share(s.extents_name.c_str(), s.extents.data(), PDI_OUT);
+                PDI_share(s.strides_name.c_str(), s.strides.data(), PDI_OUT);
+                PDI_share(s.start_name.c_str(), s.start.data(), PDI_OUT);
+            }
+            PDI_share(s.name.c_str(), s.data, s.access);
+        }
+        PDI_event(m_event_name.c_str());
+        for (Slot& s : m_slots) {
+            if (!s.rank_name.empty()) {
+                PDI_reclaim(s.rank_name.c_str());
+                PDI_reclaim(s.extents_name.c_str());
+                PDI_reclaim(s.strides_name.c_str());
+                PDI_reclaim(s.start_name.c_str());
+            }
+            PDI_reclaim(s.name.c_str());
+            s.data = nullptr;
+        }
+    }
+};
+
+/**
+ * Asynchronous double-buffered output of a (device) chunk through PDI.
+ *
+ * `write` fences the execution space instance on which the chunk is produced, then copies the
+ * chunk into one of two pinned host buffers on a dedicated instance of the execution space and
+ * returns without waiting for the copy. A single background thread, started by the constructor and
+ * joined by the destructor, waits for each copy and triggers the PDI event. A buffer is only waited
+ * on when it is reused, two steps later.
+ *
+ * The chunk must not be modified before the copy is complete: kernels only reading it can
+ * overlap the copy, `fence_copy` must be called before overwriting it. No other PDI call should
+ * occur while writes are pending, see `wait`.
+ */
+template <class ExecSpace, class ElementType, class SupportType>
+class AsyncPdiOutput
+{
+    using host_chunk_type = Chunk<
+            ElementType,
+            SupportType,
+            KokkosAllocator<ElementType, Kokkos::SharedHostPinnedSpace>>;
+
+    struct Buffer
+    {
+        host_chunk_type chunk;
+
+        PersistentPdiEvent event;
+
+        std::size_t slot;
+
+        /// Whether the buffer is queued or being output by the background thread
+        bool busy;
+    };
+
+    ExecSpace m_exec_space;
+
+    ExecSpace m_copy_space;
+
+    std::vector<Buffer> m_buffers;
+
+    std::size_t m_next = 0;
+
+    std::mutex m_mutex;
+
+    std::condition_variable m_condition;
+
+    /// Indices of the buffers to output, at most one entry per buffer
+    std::deque<std::size_t> m_queue;
+
+    std::exception_ptr m_error;
+
+    bool m_stop = false;
+
+    std::thread m_worker;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return;
+            }
+            Buffer& buffer = m_buffers[m_queue.front()];
+            m_queue.pop_front();
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                m_copy_space.fence("ddc_async_pdi_output_copy");
+                buffer.event.arm(buffer.slot, buffer.chunk.span_cview()).trigger();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error && !m_error) {
+                m_error = error;
+            }
+            buffer.busy = false;
+            m_condition.notify_all();
+        }
+    }
+
+public:
+    AsyncPdiOutput(
+            ExecSpace const& exec_space,
+            std::string const& event_name,
+            std::string const& name,
+            SupportType const& domain)
+        : m_exec_space(exec_space)
+        , m_copy_space(Kokkos::Experimental::partition_space(exec_space, 1)[0])
+    {
+        m_buffers.reserve(2);
+        for (int i = 0; i < 2; ++i) {
+            PersistentPdiEvent event(event_name);
+            std::size_t const slot = event.add_chunk(name, SupportType::rank());
+            m_buffers.push_back(
+                    Buffer {host_chunk_type(name + "_async_buffer", domain),
+                            std::move(event),
+                            slot,
+                            false});
+        }
+        m_worker = std::thread([this] { run(); });
+    }
+
+    AsyncPdiOutput(AsyncPdiOutput const& rhs) = delete;
+
+    AsyncPdiOutput(AsyncPdiOutput&& rhs) noexcept = delete;
+
+    /// Outputs the pending writes then joins the background thread, discarding their errors
+    ~AsyncPdiOutput() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        m_worker.join();
+    }
+
+    AsyncPdiOutput& operator=(AsyncPdiOutput const& rhs) = delete;
+
+    AsyncPdiOutput& operator=(AsyncPdiOutput&& rhs) noexcept = delete;
+
+    /**
+     * Starts the output of `data`
+     *
+     * Blocks until the kernels already submitted to the execution space instance of the
+     * constructor complete and until the previous output of the selected buffer is done.
+     */
+    template <class BorrowedChunk>
+    void write(BorrowedChunk&& data)
+    {
+        static_assert(is_borrowed_chunk_v<BorrowedChunk>);
+        static_assert(std::is_same_v<
+                      std::remove_const_t<chunk_value_t<BorrowedChunk>>,
+                      std::remove_const_t<ElementType>>);
+        static_assert(Kokkos::SpaceAccessibility<
+                      ExecSpace,
+                      typename std::remove_reference_t<BorrowedChunk>::memory_space>::accessible);
+        std::size_t const index = m_next;
+        Buffer& buffer = m_buffers[index];
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [&buffer] { return !buffer.busy; });
+            if (m_error) {
+                std::rethrow_exception(std::exchange(m_error, nullptr));
+            }
+        }
+        m_next = (m_next + 1) % m_buffers.size();
+        // The copy must see the results of the kernels already submitted to the solver instance
+        m_exec_space.fence("ddc_async_pdi_output_producer");
+        parallel_deepcopy(m_copy_space, buffer.chunk.span_view(), data);
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            buffer.busy = true;
+            m_queue.push_back(index);
+        }
+        m_condition.notify_all();
+    }
+
+    /// Waits for the copies of the chunks, after which they can be modified
+    void fence_copy() const
+    {
+        m_copy_space.fence("ddc_async_pdi_output_copy");
+    }
+
+    /// Waits for all pending outputs, rethrowing the first error raised by one of them
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] {
+            return std::none_of(m_buffers.begin(), m_buffers.end(), [](Buffer const& buffer) {
+                return buffer.busy;
+            });
+        });
+        if (m_error) {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+};
+
 template <PDI_inout_t access, class DataType>
 void expose_to_pdi(std::string const& name, DataType&& data)
 {
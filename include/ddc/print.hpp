@@ -5,12 +5,14 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <ostream>
 #include <sstream>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "chunk_span.hpp"
 #include "discrete_domain.hpp"
@@ -30,6 +32,9 @@ class ChunkPrinter
 
     std::stringstream m_ss;
 
+    // Whether each dimension is elided, the displayed mdspan then only holds the edge items
+    std::vector<bool> m_elided;
+
     static std::ostream& alignment(std::ostream& os, int level)
     {
         for (int i = 0; i <= level; ++i) {
@@ -134,7 +139,7 @@ public:
         auto extent = s.extent(I0);
         if constexpr (sizeof...(Is) > 0) {
             os << '[';
-            if (extent < s_threshold) {
+            if (!m_elided[level]) {
                 recursive_display(
                         os,
                         s,
@@ -173,7 +178,7 @@ public:
             os << "]";
         } else {
             os << "[";
-            if (extent < s_threshold) {
+            if (!m_elided[level]) {
                 base_case_display(os, s, largest_element, 0, extent, extent);
             } else {
                 base_case_display(os, s, largest_element, 0, s_edgeitems, extent);
@@ -190,6 +195,7 @@ public:
     template <class ElementType, class Extents, class Layout, class Accessor>
     std::size_t find_largest_displayed_element(
             Kokkos::mdspan<ElementType, Extents, Layout, Accessor> const&,
+            int /*level*/,
             std::index_sequence<>)
     {
         return 0;
@@ -206,17 +212,19 @@ public:
             std::size_t... Is>
     std::size_t find_largest_displayed_element(
             Kokkos::mdspan<ElementType, Extents, Layout, Accessor> const& s,
+            int level,
             std::index_sequence<I0, Is...>)
     {
         std::size_t ret = 0;
         auto extent = s.extent(I0);
         if constexpr (sizeof...(Is) > 0) {
-            if (extent < s_threshold) {
+            if (!m_elided[level]) {
                 for (std::size_t i0 = 0; i0 < extent; ++i0) {
                     ret = std::max(
                             ret,
                             find_largest_displayed_element(
                                     Kokkos::submdspan(s, i0, ((void)Is, Kokkos::full_extent)...),
+                                    level + 1,
                                     std::make_index_sequence<sizeof...(Is)>()));
                 }
             } else {
@@ -225,6 +233,7 @@ public:
                             ret,
                             find_largest_displayed_element(
                                     Kokkos::submdspan(s, i0, ((void)Is, Kokkos::full_extent)...),
+                                    level + 1,
                                     std::make_index_sequence<sizeof...(Is)>()));
                 }
                 for (std::size_t i0 = extent - s_edgeitems; i0 < extent; ++i0) {
@@ -232,11 +241,12 @@ public:
                             ret,
                             find_largest_displayed_element(
                                     Kokkos::submdspan(s, i0, ((void)Is, Kokkos::full_extent)...),
+                                    level + 1,
                                     std::make_index_sequence<sizeof...(Is)>()));
                 }
             }
         } else {
-            if (extent < s_threshold) {
+            if (!m_elided[level]) {
                 for (std::size_t i0 = 0; i0 < extent; ++i0) {
                     ret = std::max(ret, get_element_width(s[i0]));
                 }
@@ -253,7 +263,34 @@ public:
         return ret;
     }
 
-    explicit ChunkPrinter(std::ostream const& os)
+    /// Whether a dimension of the given extent is elided
+    static constexpr bool is_elided(std::size_t const extent) noexcept
+    {
+        return extent >= std::size_t(s_threshold);
+    }
+
+    /// Extent of the edge items of a dimension of the given extent
+    static constexpr std::size_t displayed_extent(std::size_t const extent) noexcept
+    {
+        return is_elided(extent) ? std::size_t(2 * s_edgeitems) : extent;
+    }
+
+    /// Index in the dimension of the given extent of the `i`-th displayed element
+    KOKKOS_FUNCTION static constexpr std::size_t displayed_index(
+            std::size_t const i,
+            std::size_t const extent) noexcept
+    {
+        std::size_t const threshold = s_threshold;
+        std::size_t const edgeitems = s_edgeitems;
+        return extent >= threshold && i >= edgeitems ? extent - 2 * edgeitems + i : i;
+    }
+
+    /**
+     * @param os the stream whose format is used
+     * @param elided whether each dimension is elided, the printed mdspan then only holds the
+     * `s_edgeitems` first and last items along this dimension
+     */
+    ChunkPrinter(std::ostream const& os, std::vector<bool> elided) : m_elided(std::move(elided))
     {
         m_ss.copyfmt(os);
     }
@@ -306,30 +343,70 @@ void print_dim_name(std::ostream& os, DiscreteDomain<Dim0, Dim1, Dims...> const
 
 } // namespace detail
 
+/**
+ * Print the content of a chunk, numpy-style: only the first and last items of the dimensions of
+ * at least 10 elements are displayed.
+ *
+ * The displayed items are gathered on the memory space of the chunk and only they are copied to
+ * the host, large device chunks can thus be printed without a full host mirror.
+ */
 template <class ElementType, class SupportType, class LayoutStridedPolicy, class MemorySpace>
 std::ostream& print_content(
         std::ostream& os,
         ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace> const& chunk_span)
 {
-    auto h_chunk_span = create_mirror_view_and_copy(Kokkos::HostSpace(), chunk_span);
-
-    using chunkspan_type = std::remove_cv_t<std::remove_reference_t<decltype(h_chunk_span)>>;
-    using mdspan_type = typename chunkspan_type::allocation_mdspan_type;
-    using extents = typename mdspan_type::extents_type;
+    using value_type = std::remove_const_t<ElementType>;
+    constexpr std::size_t rank = SupportType::rank();
+    using extents = Kokkos::dextents<std::size_t, rank>;
+
+    auto const allocated_mdspan = chunk_span.allocation_mdspan();
+    Kokkos::Array<std::size_t, rank> full_extents;
+    Kokkos::Array<std::size_t, rank> strides;
+    Kokkos::Array<std::size_t, rank> displayed_extents;
+    std::vector<bool> elided(rank);
+    std::size_t displayed_size = 1;
+    for (std::size_t i = 0; i < rank; ++i) {
+        full_extents[i] = allocated_mdspan.extent(i);
+        strides[i] = allocated_mdspan.stride(i);
+        displayed_extents[i] = detail::ChunkPrinter::displayed_extent(full_extents[i]);
+        elided[i] = detail::ChunkPrinter::is_elided(full_extents[i]);
+        displayed_size *= displayed_extents[i];
+    }
 
-    mdspan_type const allocated_mdspan = h_chunk_span.allocation_mdspan();
+    // Gather the displayed items in a layout right buffer
+    Kokkos::View<value_type*, MemorySpace> const displayed("ddc_print_content", displayed_size);
+    Kokkos::Array<std::size_t, rank> displayed_strides;
+    for (std::size_t i = rank; i > 0; --i) {
+        displayed_strides[i - 1] = i == rank ? 1 : displayed_strides[i] * displayed_extents[i];
+    }
+    ElementType* const data = allocated_mdspan.data_handle();
+    Kokkos::parallel_for(
+            "ddc_print_content",
+            Kokkos::RangePolicy<typename MemorySpace::execution_space>(0, displayed_size),
+            KOKKOS_LAMBDA(std::size_t const i) {
+                std::size_t offset = 0;
+                for (std::size_t d = 0; d < extents::rank(); ++d) {
+                    std::size_t const id = i / displayed_strides[d] % displayed_extents[d];
+                    offset += detail::ChunkPrinter::displayed_index(id, full_extents[d])
+                              * strides[d];
+                }
+                displayed(i) = data[offset];
+            });
+    auto const h_displayed = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), displayed);
+    std::array<std::size_t, rank> h_displayed_extents;
+    for (std::size_t i = 0; i < rank; ++i) {
+        h_displayed_extents[i] = displayed_extents[i];
+    }
+    Kokkos::mdspan<value_type const, extents, Kokkos::layout_right> const
+            displayed_mdspan(h_displayed.data(), h_displayed_extents);
 
-    ddc::detail::ChunkPrinter printer(os);
+    ddc::detail::ChunkPrinter printer(os, std::move(elided));
     std::size_t const largest_element = printer.find_largest_displayed_element(
-            allocated_mdspan,
-            std::make_index_sequence<extents::rank()>());
-
-    printer.print_impl(
-            os,
-            allocated_mdspan,
+            displayed_mdspan,
             0,
-            largest_element,
-            std::make_index_sequence<extents::rank()>());
+            std::make_index_sequence<rank>());
+
+    printer.print_impl(os, displayed_mdspan, 0, largest_element, std::make_index_sequence<rank>());
 
     return os;
 }
@@ -4,12 +4,16 @@
 
 #pragma once
 
+#include <cstdlib>
 #include <functional>
+#include <iostream>
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "discrete_space.hpp"
+#include "memory_tracker.hpp"
 
 namespace ddc {
 
@@ -21,15 +25,29 @@ class ScopeGuard
                 = std::make_optional<std::map<std::string, std::function<void()>>>();
     }
 
+    static void memory_tracker_initialization()
+    {
+        detail::g_memory_tracker.emplace();
+    }
+
+    /// The memory report is enabled by setting the environment variable `DDC_MEMORY_REPORT`
+    static bool is_memory_report_enabled()
+    {
+        char const* const env = std::getenv("DDC_MEMORY_REPORT");
+        return env != nullptr && std::string_view(env) != "" && std::string_view(env) != "0";
+    }
+
 public:
     ScopeGuard()
     {
         discretization_store_initialization();
+        memory_tracker_initialization();
     }
 
     ScopeGuard([[maybe_unused]] int argc, [[maybe_unused]] char**& argv)
     {
         discretization_store_initialization();
+        memory_tracker_initialization();
     }
 
     ScopeGuard(ScopeGuard const& x) = delete;
@@ -42,6 +60,10 @@ public:
             fn();
         }
         detail::g_discretization_store.reset();
+        if (is_memory_report_enabled()) {
+            print_memory_usage(std::cout);
+        }
+        detail::g_memory_tracker.reset();
     }
 
     ScopeGuard& operator=(ScopeGuard const& x) = delete;
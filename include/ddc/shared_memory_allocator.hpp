@@ -0,0 +1,225 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "detail/memory_mapping.hpp"
+
+#include "chunk_span.hpp"
+
+namespace ddc {
+
+/** An allocator placing the storage of a `Chunk` in a named POSIX shared memory segment.
+ *
+ * The segment is created by `allocate` and unlinked by `deallocate`, so that its name can be
+ * given to another process on the same node that opens it with `SharedMemoryChunk::open`.
+ * A given allocator can hold only one allocation at a time.
+ *
+ * This is only available on POSIX systems.
+ */
+template <class T>
+class SharedMemoryAllocator
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be shared");
+
+    std::string m_name;
+
+    static std::size_t mapping_length(std::size_t const n) noexcept
+    {
+        // `mmap` does not accept empty mappings
+        return std::max(sizeof(T) * n, std::size_t(1));
+    }
+
+public:
+    using value_type = T;
+
+    using memory_space = Kokkos::HostSpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = SharedMemoryAllocator<U>;
+    };
+
+    /** Construct an allocator for the segment `name`
+     * @param name the name of the shared memory segment, portable names are of the form "/somename"
+     */
+    explicit SharedMemoryAllocator(std::string name) : m_name(std::move(name)) {}
+
+    SharedMemoryAllocator(SharedMemoryAllocator const& x) = default;
+
+    SharedMemoryAllocator(SharedMemoryAllocator&& x) noexcept = default;
+
+    template <class U>
+    explicit SharedMemoryAllocator(SharedMemoryAllocator<U> const& x) : m_name(x.name())
+    {
+    }
+
+    ~SharedMemoryAllocator() = default;
+
+    SharedMemoryAllocator& operator=(SharedMemoryAllocator const& x) = default;
+
+    SharedMemoryAllocator& operator=(SharedMemoryAllocator&& x) noexcept = default;
+
+    std::string const& name() const noexcept
+    {
+        return m_name;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        detail::FileDescriptor const fd(
+                ::shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR));
+        if (fd.get() == -1) {
+            throw detail::system_error("Cannot create shared memory segment " + m_name, errno);
+        }
+        try {
+            fd.resize(sizeof(T) * n);
+            detail::MemoryMapping mapping(fd.get(), mapping_length(n), true);
+            return reinterpret_cast<T*>(mapping.release());
+        } catch (...) {
+            ::shm_unlink(m_name.c_str());
+            throw;
+        }
+    }
+
+    [[nodiscard]] T* allocate(std::string const&, std::size_t n) const
+    {
+        return allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) const
+    {
+        ::munmap(p, mapping_length(n));
+        ::shm_unlink(m_name.c_str());
+    }
+};
+
+template <class T, class U>
+bool operator==(SharedMemoryAllocator<T> const& lhs, SharedMemoryAllocator<U> const& rhs) noexcept
+{
+    return std::is_same_v<T, U> && lhs.name() == rhs.name();
+}
+
+#if !defined(__cpp_impl_three_way_comparison) || __cpp_impl_three_way_comparison < 201902L
+// In C++20, `a!=b` shall be automatically translated by the compiler to `!(a==b)`
+template <class T, class U>
+bool operator!=(SharedMemoryAllocator<T> const& lhs, SharedMemoryAllocator<U> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+#endif
+
+/** A view of a shared memory segment created by a `SharedMemoryAllocator`, typically from
+ * another process.
+ *
+ * A const `ElementType` maps the segment read-only. The segment stays mapped as long as this
+ * object lives, even if the owning `Chunk` is destroyed in the meantime.
+ */
+template <class ElementType, class SupportType>
+class SharedMemoryChunk
+{
+public:
+    /// type of a span of this full chunk
+    using span_type = ChunkSpan<ElementType, SupportType, Kokkos::layout_right, Kokkos::HostSpace>;
+
+    /// type of a view of this full chunk
+    using view_type
+            = ChunkSpan<ElementType const, SupportType, Kokkos::layout_right, Kokkos::HostSpace>;
+
+    using discrete_domain_type = SupportType;
+
+    using memory_space = Kokkos::HostSpace;
+
+    using element_type = ElementType;
+
+    static constexpr bool is_writable = !std::is_const_v<ElementType>;
+
+private:
+    detail::MemoryMapping m_mapping;
+
+    span_type m_span;
+
+    SharedMemoryChunk(detail::MemoryMapping&& mapping, SupportType const& domain)
+        : m_mapping(std::move(mapping))
+        , m_span(reinterpret_cast<ElementType*>(m_mapping.data()), domain)
+    {
+    }
+
+public:
+    /** Map the shared memory segment `name` as a chunk over `domain`
+     * @param name the name of the segment given to the `SharedMemoryAllocator`
+     * @param domain the domain of the chunk allocated in the segment
+     */
+    static SharedMemoryChunk open(std::string const& name, SupportType const& domain)
+    {
+        detail::FileDescriptor const fd(
+                ::shm_open(name.c_str(), is_writable ? O_RDWR : O_RDONLY, 0));
+        if (fd.get() == -1) {
+            throw detail::system_error("Cannot open shared memory segment " + name, errno);
+        }
+        std::size_t const size = domain.size() * sizeof(ElementType);
+        if (fd.file_size() < size) {
+            throw std::runtime_error(
+                    "Shared memory segment " + name + " is too small for the given domain");
+        }
+        return SharedMemoryChunk(detail::MemoryMapping(fd.get(), size, is_writable), domain);
+    }
+
+    SharedMemoryChunk(SharedMemoryChunk const& other) = delete;
+
+    SharedMemoryChunk(SharedMemoryChunk&& other) noexcept
+        : m_mapping(std::move(other.m_mapping))
+        , m_span(std::exchange(other.m_span, span_type()))
+    {
+    }
+
+    ~SharedMemoryChunk() = default;
+
+    SharedMemoryChunk& operator=(SharedMemoryChunk const& other) = delete;
+
+    SharedMemoryChunk& operator=(SharedMemoryChunk&& other) noexcept
+    {
+        m_mapping = std::move(other.m_mapping);
+        m_span = std::exchange(other.m_span, span_type());
+        return *this;
+    }
+
+    SupportType domain() const noexcept
+    {
+        return m_span.domain();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_span.size();
+    }
+
+    ElementType* data_handle() const noexcept
+    {
+        return m_span.data_handle();
+    }
+
+    view_type span_cview() const
+    {
+        return view_type(m_span);
+    }
+
+    span_type span_view() const
+    {
+        return m_span;
+    }
+};
+
+} // namespace ddc
@@ -0,0 +1,226 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <ostream>
+#include <ratio>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "coordinate.hpp"
+#include "discrete_domain.hpp"
+#include "discrete_element.hpp"
+#include "discrete_space.hpp"
+#include "discrete_vector.hpp"
+#include "real_type.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+struct StaticUniformPointSamplingBase
+{
+};
+
+template <class Ratio>
+KOKKOS_FUNCTION constexpr Real ratio_value() noexcept
+{
+    return static_cast<Real>(Ratio::num) / static_cast<Real>(Ratio::den);
+}
+
+} // namespace detail
+
+/** StaticUniformPointSampling models a uniform discretization of the provided continuous
+ *  dimension whose origin and step are known at compile time.
+ *
+ * `Origin` and `Step` are `std::ratio`, e.g. `StaticUniformPointSampling<X, std::ratio<-1>,
+ * std::ratio<1, 64>>`. Unlike `UniformPointSampling`, the free functions `coordinate`, `origin`,
+ * `step` and `distance_at_left/right` do not read the discrete space and fold into constants.
+ * The discrete space only needs to be initialized for the generic code that reads it.
+ */
+template <class CDim, class Origin, class Step>
+class StaticUniformPointSampling : detail::StaticUniformPointSamplingBase
+{
+    static_assert(Step::num > 0, "The step must be positive");
+
+public:
+    using continuous_dimension_type = CDim;
+
+    using discrete_dimension_type = StaticUniformPointSampling;
+
+    /// @brief Coordinate of the mesh point of index 0
+    static constexpr Real s_origin = detail::ratio_value<Origin>();
+
+    /// @brief Spacing step of the mesh
+    static constexpr Real s_step = detail::ratio_value<Step>();
+
+public:
+    template <class DDim, class MemorySpace>
+    class Impl
+    {
+    public:
+        using discrete_dimension_type = StaticUniformPointSampling;
+
+        using discrete_domain_type = DiscreteDomain<DDim>;
+
+        using discrete_element_type = DiscreteElement<DDim>;
+
+        using discrete_vector_type = DiscreteVector<DDim>;
+
+        Impl() = default;
+
+        Impl(Impl const&) = delete;
+
+        template <class OriginMemorySpace>
+        explicit Impl(Impl<DDim, OriginMemorySpace> const&)
+        {
+        }
+
+        Impl(Impl&&) = default;
+
+        ~Impl() = default;
+
+        Impl& operator=(Impl const& x) = delete;
+
+        Impl& operator=(Impl&& x) = default;
+
+        /// @brief Lower bound index of the mesh
+        KOKKOS_FUNCTION static constexpr Coordinate<CDim> origin() noexcept
+        {
+            return Coordinate<CDim>(s_origin);
+        }
+
+        /// @brief Lower bound index of the mesh
+        KOKKOS_FUNCTION static constexpr discrete_element_type front() noexcept
+        {
+            return create_reference_discrete_element<DDim>();
+        }
+
+        /// @brief Spacing step of the mesh
+        KOKKOS_FUNCTION static constexpr Real step() noexcept
+        {
+            return s_step;
+        }
+
+        /// @brief Convert a mesh index into a position in `CDim`
+        KOKKOS_FUNCTION static constexpr Coordinate<CDim> coordinate(
+                discrete_element_type const& icoord) noexcept
+        {
+            return Coordinate<CDim>(
+                    s_origin + static_cast<Real>((icoord - front()).value()) * s_step);
+        }
+    };
+
+    /** Construct a Impl<Kokkos::HostSpace> and the associated discrete_domain_type of `n` points
+     *  starting at the origin.
+     *
+     * @param n number of points of the domain
+     */
+    template <class DDim>
+    static std::tuple<typename DDim::template Impl<DDim, Kokkos::HostSpace>, DiscreteDomain<DDim>>
+    init(DiscreteVector<DDim> n)
+    {
+        assert(n > 0);
+        typename DDim::template Impl<DDim, Kokkos::HostSpace> disc;
+        DiscreteDomain<DDim> domain(disc.front(), n);
+        return std::make_tuple(std::move(disc), std::move(domain));
+    }
+};
+
+template <class DDim>
+struct is_static_uniform_point_sampling
+    : public std::is_base_of<detail::StaticUniformPointSamplingBase, DDim>::type
+{
+};
+
+template <class DDim>
+constexpr bool is_static_uniform_point_sampling_v = is_static_uniform_point_sampling<DDim>::value;
+
+template <
+        class DDimImpl,
+        std::enable_if_t<
+                is_static_uniform_point_sampling_v<typename DDimImpl::discrete_dimension_type>,
+                int>
+        = 0>
+std::ostream& operator<<(std::ostream& out, DDimImpl const& mesh)
+{
+    return out << "StaticUniformPointSampling( origin=" << mesh.origin()
+               << ", step=" << mesh.step() << " )";
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> coordinate(
+        DiscreteElement<DDim> const& c)
+{
+    return DDim::template Impl<DDim, Kokkos::HostSpace>::coordinate(c);
+}
+
+/// @brief Lower bound index of the mesh
+template <class DDim>
+KOKKOS_FUNCTION constexpr std::enable_if_t<
+        is_static_uniform_point_sampling_v<DDim>,
+        Coordinate<typename DDim::continuous_dimension_type>>
+origin() noexcept
+{
+    return Coordinate<typename DDim::continuous_dimension_type>(DDim::s_origin);
+}
+
+/// @brief Lower bound index of the mesh
+template <class DDim>
+KOKKOS_FUNCTION constexpr std::
+        enable_if_t<is_static_uniform_point_sampling_v<DDim>, DiscreteElement<DDim>>
+        front() noexcept
+{
+    return create_reference_discrete_element<DDim>();
+}
+
+/// @brief Spacing step of the mesh
+template <class DDim>
+KOKKOS_FUNCTION constexpr std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, Real>
+step() noexcept
+{
+    return DDim::s_step;
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> distance_at_left(
+        DiscreteElement<DDim>)
+{
+    return Coordinate<typename DDim::continuous_dimension_type>(DDim::s_step);
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> distance_at_right(
+        DiscreteElement<DDim>)
+{
+    return Coordinate<typename DDim::continuous_dimension_type>(DDim::s_step);
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> rmin(
+        DiscreteDomain<DDim> const& d)
+{
+    return coordinate(d.front());
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> rmax(
+        DiscreteDomain<DDim> const& d)
+{
+    return coordinate(d.back());
+}
+
+template <class DDim, std::enable_if_t<is_static_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> rlength(
+        DiscreteDomain<DDim> const& d)
+{
+    return rmax(d) - rmin(d);
+}
+
+} // namespace ddc
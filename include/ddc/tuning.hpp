@@ -0,0 +1,329 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+namespace ddc {
+
+namespace detail {
+
+/** Best values of the tunable parameters per problem shape.
+ *
+ * The cache is read from and written to the file given by the environment variable
+ * `DDC_TUNING_CACHE`, one "<parameter> <shape> <value>" entry per line. It only lives in memory
+ * when the variable is not set.
+ */
+class TuningCache
+{
+    mutable std::mutex m_mutex;
+
+    std::string m_path;
+
+    std::map<std::pair<std::string, std::string>, std::int64_t> m_values;
+
+    static std::map<std::pair<std::string, std::string>, std::int64_t> read(
+            std::string const& path)
+    {
+        std::map<std::pair<std::string, std::string>, std::int64_t> values;
+        std::ifstream file(path);
+        std::string name;
+        std::string shape;
+        std::int64_t value;
+        while (file >> name >> shape >> value) {
+            values[{name, shape}] = value;
+        }
+        return values;
+    }
+
+public:
+    explicit TuningCache(std::string path) : m_path(std::move(path))
+    {
+        if (!m_path.empty()) {
+            m_values = read(m_path);
+        }
+    }
+
+    std::optional<std::int64_t> find(std::string const& name, std::string const& shape) const
+    {
+        std::lock_guard const lock(m_mutex);
+        auto const it = m_values.find({name, shape});
+        if (it == m_values.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /** Store a value and rewrite the whole cache file.
+     *
+     * The entries stored in the file by other processes meanwhile are kept. The file is written
+     * to a temporary file renamed into place, so that the processes sharing it never read a
+     * partially written one.
+     */
+    void store(std::string const& name, std::string const& shape, std::int64_t const value)
+    {
+        std::lock_guard const lock(m_mutex);
+        m_values[{name, shape}] = value;
+        if (m_path.empty()) {
+            return;
+        }
+        std::map<std::pair<std::string, std::string>, std::int64_t> values = read(m_path);
+        for (auto const& [key, v] : m_values) {
+            values[key] = v;
+        }
+        std::string const tmp_path = m_path + ".tmp." + std::to_string(std::random_device()());
+        {
+            std::ofstream file(tmp_path, std::ios::trunc);
+            for (auto const& [key, v] : values) {
+                file << key.first << ' ' << key.second << ' ' << v << '\n';
+            }
+            if (!file) {
+                std::remove(tmp_path.c_str());
+                throw std::runtime_error("Cannot write the tuning cache " + m_path);
+            }
+        }
+        if (std::rename(tmp_path.c_str(), m_path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            throw std::runtime_error("Cannot write the tuning cache " + m_path);
+        }
+    }
+};
+
+inline TuningCache& tuning_cache()
+{
+    static TuningCache cache([] {
+        char const* const env = std::getenv("DDC_TUNING_CACHE");
+        return std::string(env == nullptr ? "" : env);
+    }());
+    return cache;
+}
+
+/// Identifier of the Kokkos Tools input variable holding the problem shape
+inline std::size_t kokkos_tuning_shape_id()
+{
+    static std::size_t const id = [] {
+        Kokkos::Tools::Experimental::VariableInfo info;
+        info.type = Kokkos::Tools::Experimental::ValueType::kokkos_value_string;
+        info.category = Kokkos::Tools::Experimental::StatisticalCategory::kokkos_value_categorical;
+        info.valueQuantity
+                = Kokkos::Tools::Experimental::CandidateValueType::kokkos_value_unbounded;
+        return Kokkos::Tools::Experimental::declare_input_type("ddc_problem_shape", info);
+    }();
+    return id;
+}
+
+} // namespace detail
+
+/// The offline autotuning is enabled by setting the environment variable `DDC_AUTOTUNE`
+inline bool is_autotune_enabled()
+{
+    char const* const env = std::getenv("DDC_AUTOTUNE");
+    return env != nullptr && std::string_view(env) != "" && std::string_view(env) != "0";
+}
+
+/**
+ * A parameter whose best value depends on the hardware and on the problem shape.
+ *
+ * It is declared as an output variable of the Kokkos Tuning interface the first time a tuning
+ * tool asks for it, the candidates being the only values the tool may choose.
+ */
+class TunableParameter
+{
+    std::string m_name;
+
+    std::vector<std::int64_t> m_candidates;
+
+    std::int64_t m_default_value;
+
+    mutable std::once_flag m_kokkos_declaration;
+
+    mutable std::size_t m_kokkos_id = 0;
+
+public:
+    TunableParameter(
+            std::string name,
+            std::vector<std::int64_t> candidates,
+            std::int64_t const default_value)
+        : m_name(std::move(name))
+        , m_candidates(std::move(candidates))
+        , m_default_value(default_value)
+    {
+        if (std::find(m_candidates.begin(), m_candidates.end(), m_default_value)
+            == m_candidates.end()) {
+            m_candidates.push_back(m_default_value);
+        }
+    }
+
+    TunableParameter(TunableParameter const& rhs) = delete;
+
+    TunableParameter(TunableParameter&& rhs) = delete;
+
+    ~TunableParameter() = default;
+
+    TunableParameter& operator=(TunableParameter const& rhs) = delete;
+
+    TunableParameter& operator=(TunableParameter&& rhs) = delete;
+
+    std::string const& name() const noexcept
+    {
+        return m_name;
+    }
+
+    std::vector<std::int64_t> const& candidates() const noexcept
+    {
+        return m_candidates;
+    }
+
+    std::int64_t default_value() const noexcept
+    {
+        return m_default_value;
+    }
+
+    /// Identifier of the Kokkos Tools output variable
+    std::size_t kokkos_id() const
+    {
+        std::call_once(m_kokkos_declaration, [this] {
+            Kokkos::Tools::Experimental::VariableInfo info;
+            info.type = Kokkos::Tools::Experimental::ValueType::kokkos_value_int64;
+            info.category = Kokkos::Tools::Experimental::StatisticalCategory::kokkos_value_ordinal;
+            info.valueQuantity = Kokkos::Tools::Experimental::CandidateValueType::kokkos_value_set;
+            // The candidates are neither modified nor moved after the construction
+            info.candidates = Kokkos::Tools::Experimental::make_candidate_set(
+                    m_candidates.size(),
+                    const_cast<std::int64_t*>(m_candidates.data()));
+            m_kokkos_id = Kokkos::Tools::Experimental::declare_output_type(m_name, info);
+        });
+        return m_kokkos_id;
+    }
+};
+
+/// @return the value stored by `autotune` for this parameter and shape, if any
+inline std::optional<std::int64_t> tuned_value(
+        TunableParameter const& parameter,
+        std::string const& shape)
+{
+    return detail::tuning_cache().find(parameter.name(), shape);
+}
+
+/**
+ * Selects the value of a parameter for a problem shape during the lifetime of the object.
+ *
+ * The value is, in order of priority:
+ * - the one stored in the tuning cache by `autotune`,
+ * - the one requested to the Kokkos tuning tool if any is loaded, the tuning context spanning
+ *   the lifetime of the object so that the tool measures the tuned work,
+ * - the default value of the parameter.
+ */
+class TuningContext
+{
+    std::optional<std::size_t> m_kokkos_context;
+
+    std::int64_t m_value;
+
+public:
+    TuningContext(TunableParameter const& parameter, std::string const& shape)
+        : m_value(parameter.default_value())
+    {
+        if (std::optional<std::int64_t> const cached = tuned_value(parameter, shape)) {
+            m_value = *cached;
+        } else if (Kokkos::Tools::Experimental::have_tuning_tool()) {
+            std::size_t const context = Kokkos::Tools::Experimental::get_new_context_id();
+            Kokkos::Tools::Experimental::begin_context(context);
+            m_kokkos_context = context;
+            Kokkos::Tools::Experimental::VariableValue input = Kokkos::Tools::Experimental::
+                    make_variable_value(detail::kokkos_tuning_shape_id(), shape);
+            Kokkos::Tools::Experimental::set_input_values(context, 1, &input);
+            Kokkos::Tools::Experimental::VariableValue output = Kokkos::Tools::Experimental::
+                    make_variable_value(parameter.kokkos_id(), parameter.default_value());
+            Kokkos::Tools::Experimental::request_output_values(context, 1, &output);
+            m_value = output.value.int_value;
+        }
+    }
+
+    TuningContext(TuningContext const& rhs) = delete;
+
+    TuningContext(TuningContext&& rhs) = delete;
+
+    ~TuningContext() noexcept
+    {
+        if (m_kokkos_context) {
+            Kokkos::Tools::Experimental::end_context(*m_kokkos_context);
+        }
+    }
+
+    TuningContext& operator=(TuningContext const& rhs) = delete;
+
+    TuningContext& operator=(TuningContext&& rhs) = delete;
+
+    std::int64_t value() const noexcept
+    {
+        return m_value;
+    }
+};
+
+/**
+ * Offline autotuning: time `run(value)` for each candidate of the parameter, store the fastest
+ * one in the tuning cache for this shape and return it.
+ *
+ * A candidate for which `run` throws, e.g. a solver that does not converge, is skipped. The last
+ * exception is rethrown if every candidate fails.
+ *
+ * @param repetitions the number of runs per candidate, the minimum time is kept
+ */
+template <class ExecSpace, class Runner>
+std::int64_t autotune(
+        ExecSpace const& exec_space,
+        TunableParameter const& parameter,
+        std::string const& shape,
+        Runner&& run,
+        int const repetitions = 3)
+{
+    std::int64_t best_value = parameter.default_value();
+    double best_seconds = std::numeric_limits<double>::infinity();
+    std::exception_ptr failure;
+    for (std::int64_t const value : parameter.candidates()) {
+        try {
+            double seconds = std::numeric_limits<double>::infinity();
+            for (int i = 0; i < repetitions; ++i) {
+                exec_space.fence("ddc_autotune");
+                Kokkos::Timer const timer;
+                run(value);
+                exec_space.fence("ddc_autotune");
+                seconds = std::min(seconds, timer.seconds());
+            }
+            if (seconds < best_seconds) {
+                best_seconds = seconds;
+                best_value = value;
+            }
+        } catch (std::exception const&) {
+            failure = std::current_exception();
+        }
+    }
+    if (failure && best_seconds == std::numeric_limits<double>::infinity()) {
+        std::rethrow_exception(failure);
+    }
+    detail::tuning_cache().store(parameter.name(), shape, best_value);
+    return best_value;
+}
+
+} // namespace ddc
@@ -0,0 +1,133 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_chunk_bundle_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+struct Density
+{
+};
+
+struct Vx
+{
+};
+
+struct Vy
+{
+};
+
+using Fields = ddc::FieldList<Density, Vx, Vy>;
+
+DElemXY constexpr lbound_x_y(DElemX(0), DElemY(0));
+DVectXY constexpr nelems_x_y(DVectX(10), DVectY(12));
+DDomXY constexpr dom_x_y(lbound_x_y, nelems_x_y);
+
+template <class ElementType, class Support, class Layout, class MemorySpace, class T>
+[[nodiscard]] bool all_equal_to(
+        ddc::ChunkSpan<ElementType, Support, Layout, MemorySpace> const& chunk_span,
+        T const& value)
+{
+    return ddc::parallel_transform_reduce(
+            "all_equal_to",
+            typename MemorySpace::execution_space(),
+            chunk_span.domain(),
+            true,
+            ddc::reducer::land<bool>(),
+            KOKKOS_LAMBDA(typename Support::discrete_element_type elem) {
+                return chunk_span(elem) == value;
+            });
+}
+
+} // namespace anonymous_namespace_workaround_chunk_bundle_cpp
+
+TEST(ChunkBundle, Layout)
+{
+    ddc::ChunkBundle<double, DDomXY, Fields> bundle("bundle", dom_x_y);
+    EXPECT_EQ(bundle.nb_fields(), 3U);
+    EXPECT_EQ(bundle.domain(), dom_x_y);
+    EXPECT_EQ(bundle.span_view().size(), 3 * dom_x_y.size());
+    auto const density = bundle.get<Density>();
+    auto const vx = bundle.get<Vx>();
+    auto const vy = bundle.get<Vy>();
+    EXPECT_TRUE((std::is_same_v<decltype(density), ddc::ChunkSpan<double, DDomXY> const>));
+    EXPECT_EQ(density.domain(), dom_x_y);
+    EXPECT_EQ(density.data_handle(), bundle.span_view().data_handle());
+    EXPECT_EQ(vx.data_handle(), density.data_handle() + dom_x_y.size());
+    EXPECT_EQ(vy.data_handle(), vx.data_handle() + dom_x_y.size());
+}
+
+TEST(ChunkBundle, FieldAccess)
+{
+    ddc::ChunkBundle<int, DDomXY, Fields> bundle(dom_x_y);
+    ddc::parallel_fill(bundle.get<Density>(), 1);
+    ddc::parallel_fill(bundle.get<Vx>(), 2);
+    ddc::parallel_fill(bundle.get<Vy>(), 3);
+    auto const& cbundle = bundle;
+    EXPECT_TRUE(all_equal_to(cbundle.get<Density>(), 1));
+    EXPECT_TRUE(all_equal_to(cbundle.get<Vx>(), 2));
+    EXPECT_TRUE(all_equal_to(cbundle.get<Vy>(), 3));
+}
+
+TEST(ChunkBundle, ParallelFill)
+{
+    ddc::ChunkBundle<int, DDomXY, Fields> bundle(dom_x_y);
+    ddc::parallel_fill(bundle, 4);
+    EXPECT_TRUE(all_equal_to(bundle.span_cview(), 4));
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), bundle, 5);
+    Kokkos::DefaultHostExecutionSpace().fence();
+    EXPECT_TRUE(all_equal_to(bundle.get<Vy>(), 5));
+}
+
+TEST(ChunkBundle, ParallelDeepcopy)
+{
+    ddc::ChunkBundle<int, DDomXY, Fields> bundle_src(dom_x_y);
+    ddc::parallel_fill(bundle_src.get<Density>(), 1);
+    ddc::parallel_fill(bundle_src.get<Vx>(), 2);
+    ddc::parallel_fill(bundle_src.get<Vy>(), 3);
+    ddc::ChunkBundle<int, DDomXY, Fields> bundle_dst(dom_x_y);
+    ddc::parallel_deepcopy(bundle_dst, bundle_src);
+    EXPECT_TRUE(all_equal_to(bundle_dst.get<Density>(), 1));
+    EXPECT_TRUE(all_equal_to(bundle_dst.get<Vx>(), 2));
+    EXPECT_TRUE(all_equal_to(bundle_dst.get<Vy>(), 3));
+}
+
+TEST(ChunkBundle, CreateMirror)
+{
+    ddc::ChunkBundle<int, DDomXY, Fields, ddc::DeviceAllocator<int>> bundle(dom_x_y);
+    ddc::parallel_fill(bundle, 3);
+    auto mirror = ddc::create_mirror_and_copy(bundle);
+    EXPECT_TRUE((std::is_same_v<decltype(mirror)::memory_space, Kokkos::HostSpace>));
+    EXPECT_EQ(mirror.domain(), bundle.domain());
+    EXPECT_TRUE(all_equal_to(mirror.span_cview(), 3));
+    auto device_mirror = ddc::create_mirror(Kokkos::DefaultExecutionSpace(), mirror);
+    EXPECT_TRUE((std::is_same_v<
+                 decltype(device_mirror)::memory_space,
+                 Kokkos::DefaultExecutionSpace::memory_space>));
+    EXPECT_NE(device_mirror.span_view().data_handle(), bundle.span_view().data_handle());
+}
@@ -0,0 +1,126 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <ddc/compression.hpp>
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_compression_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemXY const lbound_x_y(DElemX(3), DElemY(5));
+DVectXY const nelems_x_y(DVectX(100), DVectY(120));
+
+std::string temporary_path(std::string const& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/// Overwrite the 64-bit field at `offset` of the file
+void overwrite_field(std::string const& path, std::size_t const offset, std::uint64_t const value)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(offset);
+    file.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+} // namespace anonymous_namespace_workaround_compression_cpp
+
+TEST(Compression, RoundTrip)
+{
+    std::string const path = temporary_path("ddc_compression_round_trip.bin");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::for_each(dom, [&](DElemXY const ixy) {
+        double const x = 0.01 * ddc::select<DDimX>(ixy).uid();
+        double const y = 0.02 * ddc::select<DDimY>(ixy).uid();
+        chunk(ixy) = std::sin(x) * std::cos(y);
+    });
+    // Several blocks, the last one being partial
+    ddc::io::CompressionStats const write_stats
+            = ddc::io::write_compressed_chunk(path, chunk.span_cview(), 10000);
+    EXPECT_EQ(write_stats.raw_bytes, dom.size() * sizeof(double));
+    EXPECT_GT(write_stats.compressed_bytes, 0);
+    EXPECT_GE(write_stats.throughput(), 0);
+
+    ddc::Chunk read(dom, ddc::HostAllocator<double>());
+    ddc::io::CompressionStats const read_stats
+            = ddc::io::read_compressed_chunk(path, read.span_view());
+    EXPECT_EQ(read_stats.compressed_bytes, write_stats.compressed_bytes);
+    ddc::for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(read(ixy), chunk(ixy)); });
+
+    ddc::Chunk other(DDomXY(lbound_x_y, DVectXY(2, 2)), ddc::HostAllocator<double>());
+    EXPECT_THROW(ddc::io::read_compressed_chunk(path, other.span_view()), std::runtime_error);
+    ddc::Chunk other_type(dom, ddc::HostAllocator<long>());
+    EXPECT_THROW(ddc::io::read_compressed_chunk(path, other_type.span_view()), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(Compression, Ratio)
+{
+    std::string const path = temporary_path("ddc_compression_ratio.bin");
+    DDomX const dom(DElemX(0), DVectX(100000));
+    ddc::Chunk chunk(dom, ddc::HostAllocator<float>());
+    ddc::parallel_fill(chunk, 1.f);
+    chunk(DElemX(500)) = 2.f;
+    ddc::io::CompressionStats const stats
+            = ddc::io::write_compressed_chunk(path, chunk.span_cview());
+    EXPECT_GT(stats.ratio(), 50);
+
+    ddc::Chunk read(dom, ddc::HostAllocator<float>());
+    ddc::io::read_compressed_chunk(path, read.span_view());
+    ddc::for_each(dom, [&](DElemX const ix) { EXPECT_EQ(read(ix), chunk(ix)); });
+    std::filesystem::remove(path);
+}
+
+TEST(Compression, CorruptedHeader)
+{
+    std::string const path = temporary_path("ddc_compression_corrupted_header.bin");
+    DDomX const dom(DElemX(0), DVectX(1000));
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::parallel_fill(chunk, 1.);
+    ddc::Chunk read(dom, ddc::HostAllocator<double>());
+    // Offsets of the block size and of the description size in the header
+    std::size_t const block_size_offset = 24;
+    std::size_t const description_size_offset = 40;
+
+    for (std::uint64_t const block_size : {0, 4}) {
+        ddc::io::write_compressed_chunk(path, chunk.span_cview());
+        overwrite_field(path, block_size_offset, block_size);
+        EXPECT_THROW(ddc::io::read_compressed_chunk(path, read.span_view()), std::runtime_error);
+    }
+
+    ddc::io::write_compressed_chunk(path, chunk.span_cview());
+    overwrite_field(path, description_size_offset, ~std::uint64_t(0) - 8);
+    EXPECT_THROW(ddc::io::read_compressed_chunk(path, read.span_view()), std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,129 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_converting_chunk_span_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemXY constexpr lbound_x_y(DElemX(0), DElemY(0));
+DVectXY constexpr nelems_x_y(DVectX(10), DVectY(12));
+DDomXY constexpr dom_x_y(lbound_x_y, nelems_x_y);
+
+} // namespace anonymous_namespace_workaround_converting_chunk_span_cpp
+
+TEST(ConvertingChunkSpan, ReadWrite)
+{
+    ddc::Chunk chunk("chunk", dom_x_y, ddc::HostAllocator<float>());
+    auto const span = ddc::make_converting_chunk_span<double>(chunk.span_view());
+    EXPECT_TRUE((std::is_same_v<decltype(span)::value_type, double>));
+    EXPECT_EQ(span.domain(), dom_x_y);
+    EXPECT_EQ(span.data_handle(), chunk.data_handle());
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { span(ixy) = 0.5; });
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        span(ixy) += 1.;
+        span(ixy) *= 2.;
+    });
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        double const value = span(ixy);
+        EXPECT_EQ(value, 3.);
+        EXPECT_EQ(chunk(ixy), 3.F);
+    });
+}
+
+TEST(ConvertingChunkSpan, ReadOnly)
+{
+    ddc::Chunk chunk("chunk", dom_x_y, ddc::HostAllocator<float>());
+    ddc::parallel_fill(chunk, 0.25F);
+    auto const span = ddc::make_converting_chunk_span<double>(chunk.span_cview());
+    EXPECT_TRUE((std::is_same_v<decltype(span)::reference, double>));
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_EQ(span(ixy), 0.25); });
+}
+
+TEST(ConvertingChunkSpan, AllocationMdspan)
+{
+    ddc::Chunk chunk("chunk", dom_x_y, ddc::HostAllocator<float>());
+    auto const span = ddc::make_converting_chunk_span<double>(chunk.span_view());
+    auto const mdspan = span.allocation_mdspan();
+    for (std::size_t i = 0; i < mdspan.extent(0); ++i) {
+        for (std::size_t j = 0; j < mdspan.extent(1); ++j) {
+            mdspan[std::array<std::size_t, 2> {i, j}] = 1. * i + 0.5 * j;
+        }
+    }
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        DVectXY const d = ixy - lbound_x_y;
+        EXPECT_EQ(span(ixy), 1. * ddc::get<DDimX>(d) + 0.5 * ddc::get<DDimY>(d));
+    });
+}
+
+inline namespace anonymous_namespace_workaround_converting_chunk_span_cpp {
+
+void TestConvertingChunkSpanParallelTransformReduce()
+{
+    ddc::Chunk chunk("chunk", dom_x_y, ddc::DeviceAllocator<float>());
+    ddc::parallel_fill(chunk, 1.F);
+    auto const span = ddc::make_converting_chunk_span<double>(chunk.span_view());
+    ddc::parallel_for_each(
+            dom_x_y,
+            KOKKOS_LAMBDA(DElemXY const ixy) { span(ixy) = 2. * span(ixy); });
+    double const sum = ddc::parallel_transform_reduce(
+            dom_x_y,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElemXY const ixy) -> double { return span(ixy); });
+    EXPECT_EQ(sum, 2. * dom_x_y.size());
+}
+
+} // namespace anonymous_namespace_workaround_converting_chunk_span_cpp
+
+TEST(ConvertingChunkSpan, ParallelTransformReduce)
+{
+    TestConvertingChunkSpanParallelTransformReduce();
+}
+
+TEST(ConvertingChunkSpan, ParallelDeepcopy)
+{
+    ddc::Chunk chunk_double("chunk_double", dom_x_y, ddc::HostAllocator<double>());
+    ddc::parallel_fill(chunk_double, 1.5);
+    ddc::Chunk chunk_float("chunk_float", dom_x_y, ddc::HostAllocator<float>());
+    auto const span = ddc::make_converting_chunk_span<double>(chunk_float.span_view());
+    ddc::parallel_deepcopy(span, chunk_double);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_EQ(span(ixy), 1.5); });
+    ddc::parallel_fill(chunk_double, 0.);
+    ddc::parallel_deepcopy(chunk_double, span);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_EQ(chunk_double(ixy), 1.5); });
+}
+
+TEST(ConvertingChunkSpan, HalfPrecision)
+{
+    ddc::Chunk chunk("chunk", dom_x_y, ddc::HostAllocator<Kokkos::Experimental::half_t>());
+    auto const span = ddc::make_converting_chunk_span<double>(chunk.span_view());
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { span(ixy) = 0.125; });
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_EQ(span(ixy), 0.125); });
+}
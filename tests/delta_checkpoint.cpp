@@ -0,0 +1,142 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/delta_checkpoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_delta_checkpoint_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+std::string temporary_path(std::string const& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void remove_checkpoint(std::string const& prefix, std::size_t const nb_steps)
+{
+    std::filesystem::remove(prefix + ".manifest");
+    std::filesystem::remove(prefix + ".base");
+    for (std::size_t step = 1; step < nb_steps; ++step) {
+        std::filesystem::remove(prefix + ".delta." + std::to_string(step));
+    }
+}
+
+void TestDeltaCheckpointSaveAndRestore(std::string const& prefix)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+    // 1024 int per block, the last block being partial
+    DDomX const dom(DElemX(0), DVectX(10000));
+    ddc::Chunk chunk_alloc(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk = chunk_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            dom,
+            KOKKOS_LAMBDA(DElemX const ix) { chunk(ix) = int(ix.uid()); });
+
+    ddc::io::DeltaCheckpoint<int, DDomX> checkpoint(prefix, dom, 4096);
+    EXPECT_EQ(checkpoint.nb_blocks(), 10);
+    EXPECT_EQ(checkpoint.save(exec_space, chunk.span_cview()), 10);
+    EXPECT_EQ(checkpoint.save(exec_space, chunk.span_cview()), 0);
+
+    ddc::parallel_for_each(
+            exec_space,
+            dom,
+            KOKKOS_LAMBDA(DElemX const ix) {
+                if (ix.uid() == 2500 || ix.uid() == 9999) {
+                    chunk(ix) = -1;
+                }
+            });
+    EXPECT_EQ(checkpoint.save(exec_space, chunk.span_cview()), 2);
+
+    ddc::Chunk restored_alloc(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const restored = restored_alloc.span_view();
+    ddc::io::restore_delta_checkpoint(prefix, restored);
+    int const nb_errors = ddc::parallel_transform_reduce(
+            exec_space,
+            dom,
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(DElemX const ix) { return restored(ix) == chunk(ix) ? 0 : 1; });
+    EXPECT_EQ(nb_errors, 0);
+
+    DDomX const other_dom(DElemX(0), DVectX(10));
+    ddc::Chunk other(other_dom, ddc::DeviceAllocator<int>());
+    EXPECT_THROW(checkpoint.save(exec_space, other.span_cview()), std::runtime_error);
+    remove_checkpoint(prefix, 3);
+    EXPECT_THROW(ddc::io::restore_delta_checkpoint(prefix, restored), std::runtime_error);
+}
+
+void TestDeltaCheckpointFailedSave(std::string const& prefix)
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+    DDomX const dom(DElemX(0), DVectX(10000));
+    ddc::Chunk chunk_alloc(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk = chunk_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            dom,
+            KOKKOS_LAMBDA(DElemX const ix) { chunk(ix) = int(ix.uid()); });
+
+    ddc::io::DeltaCheckpoint<int, DDomX> checkpoint(prefix, dom, 4096);
+    EXPECT_EQ(checkpoint.save(exec_space, chunk.span_cview()), 10);
+
+    ddc::parallel_for_each(
+            exec_space,
+            dom,
+            KOKKOS_LAMBDA(DElemX const ix) {
+                if (ix.uid() == 2500) {
+                    chunk(ix) = -1;
+                }
+            });
+    // A directory in place of the delta file makes the save fail
+    std::filesystem::create_directory(prefix + ".delta.1");
+    EXPECT_THROW(checkpoint.save(exec_space, chunk.span_cview()), std::runtime_error);
+    std::filesystem::remove(prefix + ".delta.1");
+    // The changed block is still written by the next save
+    EXPECT_EQ(checkpoint.save(exec_space, chunk.span_cview()), 1);
+
+    ddc::Chunk restored_alloc(dom, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const restored = restored_alloc.span_view();
+    ddc::io::restore_delta_checkpoint(prefix, restored);
+    int const nb_errors = ddc::parallel_transform_reduce(
+            exec_space,
+            dom,
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(DElemX const ix) { return restored(ix) == chunk(ix) ? 0 : 1; });
+    EXPECT_EQ(nb_errors, 0);
+    remove_checkpoint(prefix, 2);
+}
+
+} // namespace anonymous_namespace_workaround_delta_checkpoint_cpp
+
+TEST(DeltaCheckpoint, SaveAndRestore)
+{
+    TestDeltaCheckpointSaveAndRestore(temporary_path("ddc_delta_checkpoint_save_and_restore"));
+}
+
+TEST(DeltaCheckpoint, PrefixWithSpaces)
+{
+    TestDeltaCheckpointSaveAndRestore(temporary_path("ddc delta checkpoint with spaces"));
+}
+
+TEST(DeltaCheckpoint, FailedSave)
+{
+    TestDeltaCheckpointFailedSave(temporary_path("ddc_delta_checkpoint_failed_save"));
+}
@@ -0,0 +1,310 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/dealiasing.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#if !defined(KOKKOSFFT_ENABLE_SERIAL)
+#    if defined(KOKKOS_ENABLE_SERIAL) && defined(KOKKOSFFT_ENABLE_TPL_FFTW)
+#        define KOKKOSFFT_ENABLE_SERIAL
+#    endif
+#endif
+
+inline namespace anonymous_namespace_workaround_dealiasing_cpp {
+
+template <typename X>
+struct DDim : ddc::UniformPointSampling<X>
+{
+};
+
+template <typename X>
+struct DDimP : ddc::UniformPointSampling<X>
+{
+};
+
+template <typename Kx>
+struct DFDim : ddc::PeriodicSampling<Kx>
+{
+};
+
+template <typename Kx>
+struct DFDimP : ddc::PeriodicSampling<Kx>
+{
+};
+
+template <typename... DDim>
+using DElem = ddc::DiscreteElement<DDim...>;
+
+template <typename... DDim>
+using DVect = ddc::DiscreteVector<DDim...>;
+
+template <typename... DDim>
+using DDom = ddc::DiscreteDomain<DDim...>;
+
+struct RDimX;
+struct RDimY;
+struct RDimZ;
+struct RDimW;
+struct RDimS;
+struct RDimT;
+struct RDimU;
+struct RDimV;
+
+/**
+ * The product of cos(5x) and cos(6x) is (cos(x) + cos(11x)) / 2. On 16 points, cos(11x) aliases
+ * cos(5x), whereas on the 24 points of the dealiased mesh it is a resolved mode which is then
+ * truncated. The dealiased product is thus the FFT of cos(x) / 2. The same holds for 14 points
+ * and the 21 points of the dealiased mesh.
+ */
+template <typename ExecSpace, typename MemorySpace, typename T, typename X>
+void test_dealiasing(ddc::FFT_Normalization const norm, std::size_t const n)
+{
+    using DDimX = DDim<X>;
+    using DDimXp = DDimP<X>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    using DDimFxp = DFDimP<ddc::Fourier<X>>;
+    using Tk = Kokkos::complex<ddc::detail::fft::real_type_t<T>>;
+    ExecSpace const exec_space;
+    bool const c2c = ddc::detail::fft::is_complex_v<T>;
+    double const length = 2 * Kokkos::numbers::pi;
+
+    DDom<DDimX> const x_mesh(ddc::init_discrete_space<DDimX>(DDimX::template init<DDimX>(
+            ddc::Coordinate<X>(0),
+            ddc::Coordinate<X>(length - length / n),
+            DVect<DDimX>(n))));
+    ddc::init_discrete_space<DDimXp>(ddc::init_dealiased_space<DDimXp>(x_mesh));
+    DDom<DDimXp> const xp_mesh = ddc::dealiased_mesh<DDimXp>(x_mesh);
+    EXPECT_EQ(xp_mesh.size(), (3 * n + 1) / 2);
+    EXPECT_DOUBLE_EQ(ddc::step<DDimXp>(), length / xp_mesh.size());
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    ddc::init_discrete_space<DDimFxp>(ddc::init_fourier_space<DDimFxp>(xp_mesh));
+    DDom<DDimFx> const k_mesh = ddc::fourier_mesh<DDimFx>(x_mesh, c2c);
+    DDom<DDimXp> const alloc_mesh = c2c ? xp_mesh : ddc::padded_real_mesh<DDimFxp>(xp_mesh);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::Chunk g_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const g = g_alloc.span_view();
+    ddc::Chunk h_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const h = h_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            x_mesh,
+            KOKKOS_LAMBDA(DElem<DDimX> const e) {
+                ddc::Real const x = ddc::coordinate(e);
+                f(e) = Kokkos::cos(5 * x);
+                g(e) = Kokkos::cos(6 * x);
+                h(e) = Kokkos::cos(x) / 2;
+            });
+
+    ddc::Chunk Ff_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::Chunk Fg_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Fg = Fg_alloc.span_view();
+    ddc::Chunk Fh_ref_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Fh_ref = Fh_ref_alloc.span_view();
+    ddc::fft(exec_space, Ff, f, {norm});
+    ddc::fft(exec_space, Fg, g, {norm});
+    ddc::fft(exec_space, Fh_ref, h, {norm});
+
+    ddc::Chunk fp_alloc(alloc_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const fp = fp_alloc.span_view();
+    ddc::Chunk gp_alloc(alloc_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const gp = gp_alloc.span_view();
+    ddc::ifft_padded<DDimFxp>(exec_space, fp, Ff.span_cview(), x_mesh, {norm});
+    ddc::ifft_padded<DDimFxp>(exec_space, gp, Fg.span_cview(), x_mesh, {norm});
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    // The padded iFFT samples the same function on the dealiased mesh
+    double const criterion_padded = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            xp_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimXp> const e) {
+                ddc::Real const x = ddc::coordinate(e);
+                return pow2(Kokkos::abs(fp(e) - Kokkos::cos(5 * x)));
+            }));
+    EXPECT_LE(criterion_padded, 1e-12);
+
+    ddc::parallel_for_each(
+            exec_space,
+            xp_mesh,
+            KOKKOS_LAMBDA(DElem<DDimXp> const e) { fp(e) *= gp(e); });
+    ddc::Chunk Fh_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Fh = Fh_alloc.span_view();
+    ddc::fft_truncated<DDimFxp>(exec_space, Fh, fp, x_mesh, {norm});
+
+    double const criterion_truncated = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            k_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimFx> const e) {
+                return pow2(Kokkos::abs(Fh(e) - Fh_ref(e)));
+            }));
+    EXPECT_LE(criterion_truncated, 1e-10);
+}
+
+/**
+ * The Nyquist mode cos(8x) of 16 points is split between the modes 8 and -8 of the dealiased mesh,
+ * so that the padded iFFT samples cos(8x) which is real, and gathered back by the truncated FFT.
+ */
+template <typename ExecSpace, typename MemorySpace, typename T, typename X>
+void test_dealiasing_nyquist(ddc::FFT_Normalization const norm)
+{
+    using DDimX = DDim<X>;
+    using DDimXp = DDimP<X>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    using DDimFxp = DFDimP<ddc::Fourier<X>>;
+    using Tk = Kokkos::complex<ddc::detail::fft::real_type_t<T>>;
+    ExecSpace const exec_space;
+    bool const c2c = ddc::detail::fft::is_complex_v<T>;
+    std::size_t const n = 16;
+    double const length = 2 * Kokkos::numbers::pi;
+
+    DDom<DDimX> const x_mesh(ddc::init_discrete_space<DDimX>(DDimX::template init<DDimX>(
+            ddc::Coordinate<X>(0),
+            ddc::Coordinate<X>(length - length / n),
+            DVect<DDimX>(n))));
+    ddc::init_discrete_space<DDimXp>(ddc::init_dealiased_space<DDimXp>(x_mesh));
+    DDom<DDimXp> const xp_mesh = ddc::dealiased_mesh<DDimXp>(x_mesh);
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    ddc::init_discrete_space<DDimFxp>(ddc::init_fourier_space<DDimFxp>(xp_mesh));
+    DDom<DDimFx> const k_mesh = ddc::fourier_mesh<DDimFx>(x_mesh, c2c);
+    DDom<DDimXp> const alloc_mesh = c2c ? xp_mesh : ddc::padded_real_mesh<DDimFxp>(xp_mesh);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            x_mesh,
+            KOKKOS_LAMBDA(DElem<DDimX> const e) {
+                ddc::Real const x = ddc::coordinate(e);
+                f(e) = Kokkos::cos(n / 2 * x);
+            });
+    ddc::Chunk Ff_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::fft(exec_space, Ff, f, {norm});
+
+    ddc::Chunk fp_alloc(alloc_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const fp = fp_alloc.span_view();
+    ddc::ifft_padded<DDimFxp>(exec_space, fp, Ff.span_cview(), x_mesh, {norm});
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    double const criterion_padded = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            xp_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimXp> const e) {
+                ddc::Real const x = ddc::coordinate(e);
+                return pow2(Kokkos::abs(fp(e) - Kokkos::cos(n / 2 * x)));
+            }));
+    EXPECT_LE(criterion_padded, 1e-12);
+
+    ddc::Chunk Fh_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Fh = Fh_alloc.span_view();
+    ddc::fft_truncated<DDimFxp>(exec_space, Fh, fp, x_mesh, {norm});
+
+    double const criterion_truncated = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            k_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimFx> const e) { return pow2(Kokkos::abs(Fh(e) - Ff(e))); }));
+    EXPECT_LE(criterion_truncated, 1e-10);
+}
+
+} // namespace anonymous_namespace_workaround_dealiasing_cpp
+
+#if defined(KOKKOSFFT_ENABLE_SERIAL)
+TEST(Dealiasing, SerialHostD2z)
+{
+    test_dealiasing<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            double,
+            RDimX>(ddc::FFT_Normalization::FORWARD, 16);
+}
+
+TEST(Dealiasing, SerialHostZ2z)
+{
+    test_dealiasing<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            Kokkos::complex<double>,
+            RDimY>(ddc::FFT_Normalization::BACKWARD, 16);
+}
+#endif
+
+TEST(Dealiasing, ParallelDeviceD2z)
+{
+    test_dealiasing<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimZ>(ddc::FFT_Normalization::FULL, 16);
+}
+
+TEST(Dealiasing, ParallelDeviceZ2z)
+{
+    test_dealiasing<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            RDimW>(ddc::FFT_Normalization::ORTHO, 16);
+}
+
+// 14 points give an odd number of points on the dealiased mesh
+TEST(Dealiasing, ParallelDeviceD2zOdd)
+{
+    test_dealiasing<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimS>(ddc::FFT_Normalization::BACKWARD, 14);
+}
+
+TEST(Dealiasing, ParallelDeviceZ2zOdd)
+{
+    test_dealiasing<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            RDimT>(ddc::FFT_Normalization::OFF, 14);
+}
+
+TEST(Dealiasing, ParallelDeviceD2zNyquist)
+{
+    test_dealiasing_nyquist<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimU>(ddc::FFT_Normalization::FORWARD);
+}
+
+TEST(Dealiasing, ParallelDeviceZ2zNyquist)
+{
+    test_dealiasing_nyquist<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            RDimV>(ddc::FFT_Normalization::FULL);
+}
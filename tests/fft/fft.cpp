@@ -240,6 +240,387 @@ void test_fft_norm(ddc::FFT_Normalization const norm)
     EXPECT_NEAR(FFf(FFf.domain().back()), FFf_expected, epsilon);
 }
 
+template <typename ExecSpace, typename MemorySpace, typename Tin, typename Tout, typename X>
+void test_fft_plan()
+{
+    ExecSpace const exec_space;
+    bool const full_fft
+            = ddc::detail::fft::is_complex_v<Tin> && ddc::detail::fft::is_complex_v<Tout>;
+    double const a = -10;
+    double const b = 10;
+    std::size_t const Nx = 64;
+
+    DDom<DDim<X>> const x_mesh(
+            ddc::init_discrete_space<DDim<X>>(DDim<X>::template init<DDim<X>>(
+                    ddc::Coordinate<X>(a + (b - a) / Nx / 2),
+                    ddc::Coordinate<X>(b - (b - a) / Nx / 2),
+                    DVect<DDim<X>>(Nx))));
+    ddc::init_discrete_space<DFDim<ddc::Fourier<X>>>(
+            ddc::init_fourier_space<DFDim<ddc::Fourier<X>>>(x_mesh));
+    DDom<DFDim<ddc::Fourier<X>>> const k_mesh
+            = ddc::fourier_mesh<DFDim<ddc::Fourier<X>>>(x_mesh, full_fft);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::Chunk f_bis_alloc(x_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f_bis = f_bis_alloc.span_view();
+    ddc::Chunk FFf_alloc(x_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const FFf = FFf_alloc.span_view();
+    ddc::Chunk Ff_alloc(k_mesh, ddc::KokkosAllocator<Tout, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::Chunk Ff_ref_alloc(k_mesh, ddc::KokkosAllocator<Tout, MemorySpace>());
+    ddc::ChunkSpan const Ff_ref = Ff_ref_alloc.span_view();
+
+    ddc::kwArgs_fft const kwargs {ddc::FFT_Normalization::FULL};
+    ddc::FFTPlan const fft_plan(exec_space, Ff, f, ddc::FFT_Direction::FORWARD, kwargs);
+    ddc::FFTPlan const ifft_plan(exec_space, FFf, Ff, ddc::FFT_Direction::BACKWARD, kwargs);
+    EXPECT_EQ(fft_plan.direction(), ddc::FFT_Direction::FORWARD);
+    EXPECT_EQ(ifft_plan.normalization(), ddc::FFT_Normalization::FULL);
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    double const epsilon
+            = std::is_same_v<ddc::detail::fft::real_type_t<Tin>, double> ? 1e-15 : 1e-7;
+
+    // The plans are executed several times on different data
+    for (int i = 1; i <= 3; ++i) {
+        ddc::parallel_for_each(
+                exec_space,
+                x_mesh,
+                KOKKOS_LAMBDA(DElem<DDim<X>> const e) {
+                    ddc::Real const x = ddc::coordinate(e);
+                    f(e) = i * Kokkos::exp(-x * x / (2 * i));
+                });
+        ddc::parallel_deepcopy(exec_space, f_bis, f);
+        ddc::fft(exec_space, Ff_ref, f_bis, kwargs);
+        fft_plan(Ff, f);
+        Kokkos::fence();
+
+        double const criterion = Kokkos::sqrt(ddc::parallel_transform_reduce(
+                exec_space,
+                k_mesh,
+                0.,
+                ddc::reducer::sum<double>(),
+                KOKKOS_LAMBDA(DElem<DFDim<ddc::Fourier<X>>> const e) {
+                    return pow2(Kokkos::abs(Ff(e) - Ff_ref(e)));
+                }));
+        EXPECT_LE(criterion, epsilon) << "Distance between plan and fft : " << criterion;
+
+        // C2R iFFT does not preserve input, the spectral function is thus recomputed
+        ifft_plan(FFf, Ff_ref);
+        Kokkos::fence();
+        double const criterion2 = Kokkos::sqrt(ddc::parallel_transform_reduce(
+                exec_space,
+                x_mesh,
+                0.,
+                ddc::reducer::sum<double>(),
+                KOKKOS_LAMBDA(DElem<DDim<X>> const e) {
+                    return pow2(Kokkos::abs(FFf(e) - f(e)) / i) / Nx;
+                }));
+        EXPECT_LE(criterion2, epsilon)
+                << "Distance between input and iFFT(FFT(input)) : " << criterion2;
+    }
+}
+
+struct DDimBatch
+{
+};
+
+// The Fourier dimension associated to a dimension, batch dimensions are not transformed
+template <typename DDimX>
+struct to_fourier
+{
+    using type = DFDim<ddc::Fourier<typename DDimX::continuous_dimension_type>>;
+};
+
+template <>
+struct to_fourier<DDimBatch>
+{
+    using type = DDimBatch;
+};
+
+template <
+        typename ExecSpace,
+        typename MemorySpace,
+        typename Tin,
+        typename Tout,
+        typename X,
+        typename... DDimXB>
+void test_fft_batched()
+{
+    using DDimX = DDim<X>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    ExecSpace const exec_space;
+    bool const full_fft
+            = ddc::detail::fft::is_complex_v<Tin> && ddc::detail::fft::is_complex_v<Tout>;
+    double const a = -10;
+    double const b = 10;
+    std::size_t const Nx = 64;
+    std::size_t const Nb = 3;
+
+    DDom<DDimX> const x_mesh(ddc::init_discrete_space<DDimX>(DDimX::template init<DDimX>(
+            ddc::Coordinate<X>(a + (b - a) / Nx / 2),
+            ddc::Coordinate<X>(b - (b - a) / Nx / 2),
+            DVect<DDimX>(Nx))));
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    DDom<DDimBatch> const batch_mesh(DElem<DDimBatch>(0), DVect<DDimBatch>(Nb));
+    DDom<DDimXB...> const xb_mesh(x_mesh, batch_mesh);
+    DDom<typename to_fourier<DDimXB>::type...> const kb_mesh
+            = ddc::fourier_mesh<typename to_fourier<DDimXB>::type...>(xb_mesh, full_fft);
+    EXPECT_EQ(DDom<DDimBatch>(kb_mesh), batch_mesh);
+
+    ddc::Chunk f_alloc(xb_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            xb_mesh,
+            KOKKOS_LAMBDA(DElem<DDimXB...> const e) {
+                ddc::Real const x = ddc::coordinate(DElem<DDimX>(e));
+                f(e) = (DElem<DDimBatch>(e).uid() + 1) * Kokkos::exp(-x * x / 2);
+            });
+
+    ddc::Chunk Ff_alloc(kb_mesh, ddc::KokkosAllocator<Tout, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::fft(exec_space, Ff, f, {ddc::FFT_Normalization::FULL});
+
+    ddc::Chunk FFf_alloc(xb_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const FFf = FFf_alloc.span_view();
+    ddc::ifft(exec_space, FFf, Ff, {ddc::FFT_Normalization::FULL});
+    Kokkos::fence();
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    // FFT(b * exp(-x^2/2)) = b * exp(-k^2/2) for each batch index b
+    double const criterion = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            kb_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<typename to_fourier<DDimXB>::type...> const e) {
+                double const k = ddc::coordinate(DElem<DDimFx>(e));
+                double const nb = DElem<DDimBatch>(e).uid() + 1;
+                double const diff = Kokkos::abs(Ff(e)) / nb - Kokkos::exp(-k * k / 2);
+                return pow2(diff) / (Nb * Nx / 2);
+            }));
+
+    double const criterion2 = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            xb_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimXB...> const e) {
+                return pow2(Kokkos::abs(FFf(e)) - Kokkos::abs(f(e))) / (Nb * Nx);
+            }));
+
+    double const epsilon
+            = std::is_same_v<ddc::detail::fft::real_type_t<Tin>, double> ? 1e-14 : 1e-6;
+    EXPECT_LE(criterion, epsilon)
+            << "Distance between analytical prediction and numerical result : " << criterion;
+    EXPECT_LE(criterion2, epsilon)
+            << "Distance between input and iFFT(FFT(input)) : " << criterion2;
+}
+
+template <typename ExecSpace, typename MemorySpace, typename Tin, typename X, typename Y>
+void test_fft_inplace(std::size_t const Ny)
+{
+    using DDimX = DDim<X>;
+    using DDimY = DDim<Y>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    using DDimFy = DFDim<ddc::Fourier<Y>>;
+    using Tout = Kokkos::complex<ddc::detail::fft::real_type_t<Tin>>;
+    ExecSpace const exec_space;
+    bool const full_fft = ddc::detail::fft::is_complex_v<Tin>;
+    double const a = -10;
+    double const b = 10;
+    std::size_t const Nx = 32;
+
+    DDom<DDimX> const x_mesh(ddc::init_discrete_space<DDimX>(DDimX::template init<DDimX>(
+            ddc::Coordinate<X>(a + (b - a) / Nx / 2),
+            ddc::Coordinate<X>(b - (b - a) / Nx / 2),
+            DVect<DDimX>(Nx))));
+    DDom<DDimY> const y_mesh(ddc::init_discrete_space<DDimY>(DDimY::template init<DDimY>(
+            ddc::Coordinate<Y>(a + (b - a) / Ny / 2),
+            ddc::Coordinate<Y>(b - (b - a) / Ny / 2),
+            DVect<DDimY>(Ny))));
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    ddc::init_discrete_space<DDimFy>(ddc::init_fourier_space<DDimFy>(y_mesh));
+    DDom<DDimX, DDimY> const xy_mesh(x_mesh, y_mesh);
+    DDom<DDimFx, DDimFy> const k_mesh = ddc::fourier_mesh<DDimFx, DDimFy>(xy_mesh, full_fft);
+    DDom<DDimX, DDimY> const alloc_mesh
+            = full_fft ? xy_mesh : ddc::padded_real_mesh<DDimFx, DDimFy>(xy_mesh);
+    if (!full_fft) {
+        EXPECT_EQ(alloc_mesh.extents(), (DVect<DDimX, DDimY>(Nx, 2 * (Ny / 2 + 1))));
+    }
+
+    ddc::Chunk f_alloc(xy_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            xy_mesh,
+            KOKKOS_LAMBDA(DElem<DDimX, DDimY> const e) {
+                ddc::Real const x = ddc::coordinate(DElem<DDimX>(e));
+                ddc::Real const y = ddc::coordinate(DElem<DDimY>(e));
+                f(e) = Kokkos::exp(-(x * x + y * y) / 2);
+            });
+
+    // Reference out-of-place transform
+    ddc::Chunk f_bis_alloc(xy_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const f_bis = f_bis_alloc.span_view();
+    ddc::parallel_deepcopy(f_bis, f);
+    ddc::Chunk Ff_ref_alloc(k_mesh, ddc::KokkosAllocator<Tout, MemorySpace>());
+    ddc::ChunkSpan const Ff_ref = Ff_ref_alloc.span_view();
+    ddc::fft(exec_space, Ff_ref, f_bis, {ddc::FFT_Normalization::FULL});
+
+    ddc::Chunk inout_alloc(alloc_mesh, ddc::KokkosAllocator<Tin, MemorySpace>());
+    ddc::ChunkSpan const inout = inout_alloc.span_view();
+    ddc::parallel_deepcopy(inout[xy_mesh], f);
+    ddc::ChunkSpan const Ff = ddc::fft_inplace<
+            DDimFx,
+            DDimFy>(exec_space, inout, xy_mesh, {ddc::FFT_Normalization::FULL});
+    EXPECT_EQ(static_cast<void*>(Ff.data_handle()), static_cast<void*>(inout.data_handle()));
+    EXPECT_EQ(Ff.domain(), k_mesh);
+    Kokkos::fence();
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    double const criterion = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            k_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimFx, DDimFy> const e) {
+                return pow2(Kokkos::abs(Ff(e) - Ff_ref(e)));
+            }));
+
+    ddc::ChunkSpan const FFf = ddc::ifft_inplace<Tin>(
+            exec_space,
+            Ff,
+            xy_mesh,
+            {ddc::FFT_Normalization::FULL})[xy_mesh];
+    Kokkos::fence();
+    double const criterion2 = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            xy_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimX, DDimY> const e) {
+                return pow2(Kokkos::abs(FFf(e) - f(e))) / (Nx * Ny);
+            }));
+
+    double const epsilon
+            = std::is_same_v<ddc::detail::fft::real_type_t<Tin>, double> ? 1e-14 : 1e-6;
+    EXPECT_LE(criterion, epsilon)
+            << "Distance between in-place and out-of-place FFT : " << criterion;
+    EXPECT_LE(criterion2, epsilon)
+            << "Distance between input and iFFT(FFT(input)) : " << criterion2;
+}
+
+template <typename ExecSpace, typename MemorySpace, typename T, typename X>
+void test_spectral_operator(ddc::FFT_Normalization const norm)
+{
+    using DDimX = DDim<X>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    using Tk = Kokkos::complex<ddc::detail::fft::real_type_t<T>>;
+    ExecSpace const exec_space;
+    bool const full_fft = ddc::detail::fft::is_complex_v<T>;
+    double const a = -10;
+    double const b = 10;
+    std::size_t const Nx = 64;
+
+    DDom<DDimX> const x_mesh(ddc::init_discrete_space<DDimX>(DDimX::template init<DDimX>(
+            ddc::Coordinate<X>(a + (b - a) / Nx / 2),
+            ddc::Coordinate<X>(b - (b - a) / Nx / 2),
+            DVect<DDimX>(Nx))));
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    DDom<DDimFx> const k_mesh = ddc::fourier_mesh<DDimFx>(x_mesh, full_fft);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::parallel_for_each(
+            exec_space,
+            x_mesh,
+            KOKKOS_LAMBDA(DElem<DDimX> const e) {
+                ddc::Real const x = ddc::coordinate(e);
+                f(e) = Kokkos::exp(-x * x / 2);
+            });
+    ddc::Chunk f_ref_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const f_ref = f_ref_alloc.span_view();
+    ddc::parallel_deepcopy(f_ref, f);
+    ddc::Chunk g_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const g = g_alloc.span_view();
+
+    // second derivative
+    auto const symbol = KOKKOS_LAMBDA(DElem<DDimFx> const ik)
+    {
+        double const k = ddc::coordinate(ik);
+        return -k * k;
+    };
+
+    // Reference unfused computation
+    ddc::Chunk f_bis_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const f_bis = f_bis_alloc.span_view();
+    ddc::parallel_deepcopy(f_bis, f);
+    ddc::Chunk Ff_alloc(k_mesh, ddc::KokkosAllocator<Tk, MemorySpace>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::fft(exec_space, Ff, f_bis, {norm});
+    ddc::parallel_for_each(
+            exec_space,
+            k_mesh,
+            KOKKOS_LAMBDA(DElem<DDimFx> const ik) { Ff(ik) *= symbol(ik); });
+    ddc::Chunk g_ref_alloc(x_mesh, ddc::KokkosAllocator<T, MemorySpace>());
+    ddc::ChunkSpan const g_ref = g_ref_alloc.span_view();
+    ddc::ifft(exec_space, g_ref, Ff, {norm});
+
+    ddc::SpectralOperator spectral_operator(exec_space, g, f, k_mesh, {norm});
+
+    auto const pow2 = KOKKOS_LAMBDA(double x)
+    {
+        return x * x;
+    };
+
+    double const epsilon
+            = std::is_same_v<ddc::detail::fft::real_type_t<T>, double> ? 1e-12 : 1e-4;
+    // The operator is applied several times to check the reuse of the plans and workspace
+    for (int i = 0; i < 2; ++i) {
+        spectral_operator(g, f, symbol);
+        Kokkos::fence();
+        double const criterion = Kokkos::sqrt(ddc::parallel_transform_reduce(
+                exec_space,
+                x_mesh,
+                0.,
+                ddc::reducer::sum<double>(),
+                KOKKOS_LAMBDA(DElem<DDimX> const e) {
+                    return pow2(Kokkos::abs(g(e) - g_ref(e))) / Nx;
+                }));
+        double const scale = norm == ddc::FFT_Normalization::OFF ? Nx : 1;
+        EXPECT_LE(criterion, epsilon * scale)
+                << "Distance between fused and unfused spectral operator : " << criterion;
+
+        // The workspace can be used as a scratch buffer between two applications
+        ddc::ChunkSpan const workspace = spectral_operator.workspace();
+        EXPECT_EQ(workspace.domain(), k_mesh);
+        ddc::parallel_fill(exec_space, workspace, Tk(1));
+    }
+
+    // The input is preserved
+    double const criterion2 = Kokkos::sqrt(ddc::parallel_transform_reduce(
+            exec_space,
+            x_mesh,
+            0.,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(DElem<DDimX> const e) { return pow2(Kokkos::abs(f(e) - f_ref(e))); }));
+    EXPECT_EQ(criterion2, 0);
+}
+
 struct RDimX;
 struct RDimY;
 struct RDimZ;
@@ -742,3 +1123,212 @@ TEST(FftParallelDevice, Z2zIn3d)
             RDimY,
             RDimZ>();
 }
+
+#if defined(KOKKOSFFT_ENABLE_SERIAL)
+TEST(FftPlan, SerialHostR2c)
+{
+    test_fft_plan<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            float,
+            Kokkos::complex<float>,
+            RDimX>();
+}
+
+TEST(FftPlan, SerialHostZ2z)
+{
+    test_fft_plan<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            Kokkos::complex<double>,
+            Kokkos::complex<double>,
+            RDimX>();
+}
+#endif
+
+TEST(FftPlan, ParallelDeviceD2z)
+{
+    test_fft_plan<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            Kokkos::complex<double>,
+            RDimX>();
+}
+
+TEST(FftPlan, WrongDirection)
+{
+    using DDimX = DDim<RDimX>;
+    using DDimFx = DFDim<ddc::Fourier<RDimX>>;
+    DDom<DDimX> const x_mesh(
+            ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(
+                    ddc::Coordinate<RDimX>(0),
+                    ddc::Coordinate<RDimX>(1),
+                    DVect<DDimX>(8))));
+    ddc::init_discrete_space<DDimFx>(ddc::init_fourier_space<DDimFx>(x_mesh));
+    DDom<DDimFx> const k_mesh = ddc::fourier_mesh<DDimFx>(x_mesh, false);
+    ddc::Chunk f_alloc(x_mesh, ddc::DeviceAllocator<double>());
+    ddc::Chunk Ff_alloc(k_mesh, ddc::DeviceAllocator<Kokkos::complex<double>>());
+    EXPECT_THROW(
+            ddc::FFTPlan(
+                    Kokkos::DefaultExecutionSpace(),
+                    Ff_alloc.span_view(),
+                    f_alloc.span_view(),
+                    ddc::FFT_Direction::BACKWARD),
+            std::runtime_error);
+}
+
+#if defined(KOKKOSFFT_ENABLE_SERIAL)
+TEST(FftBatched, SerialHostR2cBatchFirst)
+{
+    test_fft_batched<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            float,
+            Kokkos::complex<float>,
+            RDimX,
+            DDimBatch,
+            DDim<RDimX>>();
+}
+
+TEST(FftBatched, SerialHostR2cBatchLast)
+{
+    test_fft_batched<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            float,
+            Kokkos::complex<float>,
+            RDimX,
+            DDim<RDimX>,
+            DDimBatch>();
+}
+#endif
+
+TEST(FftBatched, ParallelDeviceD2zBatchFirst)
+{
+    test_fft_batched<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            Kokkos::complex<double>,
+            RDimX,
+            DDimBatch,
+            DDim<RDimX>>();
+}
+
+TEST(FftBatched, ParallelDeviceZ2zBatchLast)
+{
+    test_fft_batched<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            Kokkos::complex<double>,
+            RDimX,
+            DDim<RDimX>,
+            DDimBatch>();
+}
+
+TEST(FourierMesh, Batched)
+{
+    using DDimX = DDim<RDimX>;
+    using DDimY = DDim<RDimY>;
+    using DDimFx = DFDim<ddc::Fourier<RDimX>>;
+
+    ddc::DiscreteElement<DDimX> const delem_x = ddc::init_trivial_half_bounded_space<DDimX>();
+    ddc::DiscreteElement<DDimY> const delem_y = ddc::init_trivial_half_bounded_space<DDimY>();
+
+    ddc::DiscreteElement<DDimX, DDimY> const delem_xy(delem_x, delem_y);
+    ddc::DiscreteVector<DDimX, DDimY> const dvect_xy(10, 11);
+    ddc::DiscreteDomain<DDimX, DDimY> const ddom_xy(delem_xy, dvect_xy);
+
+    // Only X is transformed, it is thus the halved dimension of the R2C mesh
+    ddc::DiscreteDomain<DDimFx, DDimY> const ddom_c2r
+            = ddc::fourier_mesh<DDimFx, DDimY>(ddom_xy, false);
+    EXPECT_EQ(ddom_c2r.extents(), (ddc::DiscreteVector<DDimFx, DDimY>(6, 11)));
+    EXPECT_EQ(ddc::DiscreteDomain<DDimY>(ddom_c2r), ddc::DiscreteDomain<DDimY>(ddom_xy));
+}
+
+// The padded real meshes of 2k and 2k+1 points are the same, both parities are thus checked
+#if defined(KOKKOSFFT_ENABLE_SERIAL)
+TEST(FftInplace, SerialHostR2cEven)
+{
+    test_fft_inplace<Kokkos::Serial, Kokkos::Serial::memory_space, float, RDimX, RDimY>(32);
+}
+
+TEST(FftInplace, SerialHostR2cOdd)
+{
+    test_fft_inplace<Kokkos::Serial, Kokkos::Serial::memory_space, float, RDimX, RDimY>(33);
+}
+
+TEST(FftInplace, SerialHostC2c)
+{
+    test_fft_inplace<
+            Kokkos::Serial,
+            Kokkos::Serial::memory_space,
+            Kokkos::complex<float>,
+            RDimX,
+            RDimY>(33);
+}
+#endif
+
+TEST(FftInplace, ParallelDeviceD2zEven)
+{
+    test_fft_inplace<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimX,
+            RDimY>(32);
+}
+
+TEST(FftInplace, ParallelDeviceD2zOdd)
+{
+    test_fft_inplace<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimX,
+            RDimY>(33);
+}
+
+TEST(FftInplace, ParallelDeviceZ2z)
+{
+    test_fft_inplace<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            RDimX,
+            RDimY>(33);
+}
+
+#if defined(KOKKOSFFT_ENABLE_SERIAL)
+TEST(SpectralOperator, SerialHostR2cOff)
+{
+    test_spectral_operator<Kokkos::Serial, Kokkos::Serial::memory_space, float, RDimX>(
+            ddc::FFT_Normalization::OFF);
+}
+
+TEST(SpectralOperator, SerialHostR2cFull)
+{
+    test_spectral_operator<Kokkos::Serial, Kokkos::Serial::memory_space, float, RDimX>(
+            ddc::FFT_Normalization::FULL);
+}
+#endif
+
+TEST(SpectralOperator, ParallelDeviceD2zFull)
+{
+    test_spectral_operator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            double,
+            RDimX>(ddc::FFT_Normalization::FULL);
+}
+
+TEST(SpectralOperator, ParallelDeviceZ2zBackward)
+{
+    test_spectral_operator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::complex<double>,
+            RDimX>(ddc::FFT_Normalization::BACKWARD);
+}
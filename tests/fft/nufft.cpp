@@ -0,0 +1,184 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+#include <ddc/kernels/nufft.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_nufft_cpp {
+
+template <typename X>
+struct DDim : ddc::NonUniformPointSampling<X>
+{
+};
+
+template <typename Kx>
+struct DFDim : ddc::PeriodicSampling<Kx>
+{
+};
+
+template <typename... DDim>
+using DElem = ddc::DiscreteElement<DDim...>;
+
+template <typename... DDim>
+using DDom = ddc::DiscreteDomain<DDim...>;
+
+struct RDimX;
+struct RDimY;
+struct RDimZ;
+struct RDimW;
+
+double const length = 3;
+
+/// Non-uniform points spanning a bit more than a period, to check the wrapping
+template <typename X>
+DDom<DDim<X>> init_non_uniform_mesh(std::size_t const n)
+{
+    std::vector<ddc::Coordinate<X>> points(n);
+    for (std::size_t j = 0; j < n; ++j) {
+        double const s = (j + 0.4 * Kokkos::sin(3. * j)) / n;
+        points[j] = ddc::Coordinate<X>(1.2 * length * s - length / 3);
+    }
+    return DDom<DDim<X>>(
+            ddc::init_discrete_space<DDim<X>>(DDim<X>::template init<DDim<X>>(points)));
+}
+
+template <typename X>
+DDom<DFDim<ddc::Fourier<X>>> init_modes(std::size_t const n_modes)
+{
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    ddc::init_discrete_space<DDimFx>(ddc::init_nufft_fourier_space<DDimFx>(length, n_modes));
+    return DDom<DDimFx>(DElem<DDimFx>(0), ddc::DiscreteVector<DDimFx>(n_modes));
+}
+
+/// Wavenumber of a mode, negative frequencies being stored at the end of the Fourier mesh
+template <typename DDimFx>
+double wavenumber(DElem<DDimFx> const ik, std::size_t const n_modes)
+{
+    std::size_t const i = (ik - DElem<DDimFx>(0)).value();
+    double const mode = i < (n_modes + 1) / 2 ? double(i) : double(i) - double(n_modes);
+    return 2 * Kokkos::numbers::pi * mode / length;
+}
+
+/// The type 1 and type 2 transforms match the direct sums
+template <typename ExecSpace, typename X>
+void test_nufft_1d()
+{
+    using DDimX = DDim<X>;
+    using DDimFx = DFDim<ddc::Fourier<X>>;
+    using T = Kokkos::complex<double>;
+    ExecSpace const exec_space;
+    std::size_t const n_points = 50;
+    std::size_t const n_modes = 32;
+    DDom<DDimX> const x_mesh = init_non_uniform_mesh<X>(n_points);
+    DDom<DDimFx> const k_mesh = init_modes<X>(n_modes);
+    EXPECT_DOUBLE_EQ(ddc::step<DDimFx>(), 2 * Kokkos::numbers::pi / length);
+
+    ddc::Chunk f_host(x_mesh, ddc::HostAllocator<T>());
+    ddc::for_each(x_mesh, [&](DElem<DDimX> const ix) {
+        double const j = (ix - x_mesh.front()).value();
+        f_host(ix) = T(Kokkos::cos(j), Kokkos::sin(2 * j));
+    });
+    ddc::Chunk Ff_host(k_mesh, ddc::HostAllocator<T>());
+    ddc::for_each(k_mesh, [&](DElem<DDimFx> const ik) {
+        double const i = (ik - k_mesh.front()).value();
+        Ff_host(ik) = T(Kokkos::sin(i), 1 / (1 + i));
+    });
+
+    auto f = ddc::create_mirror_and_copy(exec_space, f_host.span_cview());
+    auto Ff = ddc::create_mirror_and_copy(exec_space, Ff_host.span_cview());
+    auto Ff_nufft = ddc::create_mirror(exec_space, Ff_host.span_cview());
+    auto f_nufft = ddc::create_mirror(exec_space, f_host.span_cview());
+
+    ddc::NUFFTPlan<
+            ExecSpace,
+            T,
+            DDom<DDimX>,
+            DDom<DDimFx>,
+            typename ExecSpace::memory_space>
+            plan(exec_space, k_mesh, x_mesh);
+    plan.forward(Ff_nufft.span_view(), f.span_cview());
+    plan.backward(f_nufft.span_view(), Ff.span_cview());
+    auto Ff_nufft_host = ddc::create_mirror_and_copy(Ff_nufft.span_cview());
+    auto f_nufft_host = ddc::create_mirror_and_copy(f_nufft.span_cview());
+
+    double const epsilon = 1e-10;
+    ddc::for_each(k_mesh, [&](DElem<DDimFx> const ik) {
+        double const k = wavenumber(ik, n_modes);
+        T sum(0);
+        for (DElem<DDimX> const ix : x_mesh) {
+            double const x = ddc::coordinate(ix);
+            sum += f_host(ix) * T(Kokkos::cos(k * x), -Kokkos::sin(k * x));
+        }
+        EXPECT_LE(Kokkos::abs(Ff_nufft_host(ik) - sum), epsilon * n_points);
+    });
+    ddc::for_each(x_mesh, [&](DElem<DDimX> const ix) {
+        double const x = ddc::coordinate(ix);
+        T sum(0);
+        for (DElem<DDimFx> const ik : k_mesh) {
+            double const k = wavenumber(ik, n_modes);
+            sum += Ff_host(ik) * T(Kokkos::cos(k * x), Kokkos::sin(k * x));
+        }
+        EXPECT_LE(Kokkos::abs(f_nufft_host(ix) - sum), epsilon * n_modes);
+    });
+}
+
+} // namespace anonymous_namespace_workaround_nufft_cpp
+
+TEST(Nufft, ParallelHost1d)
+{
+    test_nufft_1d<Kokkos::DefaultHostExecutionSpace, RDimX>();
+}
+
+TEST(Nufft, ParallelDevice1d)
+{
+    test_nufft_1d<Kokkos::DefaultExecutionSpace, RDimY>();
+}
+
+TEST(Nufft, ParallelHost2d)
+{
+    using DDimX = DDim<RDimZ>;
+    using DDimY = DDim<RDimW>;
+    using DDimFx = DFDim<ddc::Fourier<RDimZ>>;
+    using DDimFy = DFDim<ddc::Fourier<RDimW>>;
+    using T = Kokkos::complex<double>;
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    std::size_t const n_modes_x = 16;
+    std::size_t const n_modes_y = 11;
+    DDom<DDimX, DDimY> const xy_mesh(
+            init_non_uniform_mesh<RDimZ>(20),
+            init_non_uniform_mesh<RDimW>(15));
+    DDom<DDimFx, DDimFy> const k_mesh(init_modes<RDimZ>(n_modes_x), init_modes<RDimW>(n_modes_y));
+
+    ddc::Chunk f_alloc(xy_mesh, ddc::HostAllocator<T>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::for_each(xy_mesh, [&](DElem<DDimX, DDimY> const e) {
+        double const x = ddc::coordinate(DElem<DDimX>(e));
+        double const y = ddc::coordinate(DElem<DDimY>(e));
+        f(e) = T(Kokkos::exp(-x * x), x * y);
+    });
+    ddc::Chunk Ff_alloc(k_mesh, ddc::HostAllocator<T>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::nufft(exec_space, Ff, f.span_cview());
+    exec_space.fence();
+
+    ddc::for_each(k_mesh, [&](DElem<DDimFx, DDimFy> const ik) {
+        double const kx = wavenumber(DElem<DDimFx>(ik), n_modes_x);
+        double const ky = wavenumber(DElem<DDimFy>(ik), n_modes_y);
+        T sum(0);
+        ddc::for_each(xy_mesh, [&](DElem<DDimX, DDimY> const e) {
+            double const phase = kx * ddc::coordinate(DElem<DDimX>(e))
+                                 + ky * ddc::coordinate(DElem<DDimY>(e));
+            sum += f(e) * T(Kokkos::cos(phase), -Kokkos::sin(phase));
+        });
+        EXPECT_LE(Kokkos::abs(Ff(ik) - sum), 1e-10 * xy_mesh.size());
+    });
+}
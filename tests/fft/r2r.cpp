@@ -0,0 +1,202 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+#include <ddc/kernels/r2r.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#if defined(KOKKOSFFT_ENABLE_TPL_FFTW)
+
+inline namespace anonymous_namespace_workaround_r2r_cpp {
+
+template <typename X>
+struct DDim : ddc::UniformPointSampling<X>
+{
+};
+
+template <typename Kx>
+struct DKDim : ddc::UniformPointSampling<Kx>
+{
+};
+
+template <typename... DDim>
+using DElem = ddc::DiscreteElement<DDim...>;
+
+template <typename... DDim>
+using DVect = ddc::DiscreteVector<DDim...>;
+
+template <typename... DDim>
+using DDom = ddc::DiscreteDomain<DDim...>;
+
+struct DDimBatch
+{
+};
+
+struct RDimX;
+
+/// Cell-centered mesh of the box [0, 2]
+template <typename X>
+DDom<DDim<X>> init_cell_centered_mesh(std::size_t const n)
+{
+    double const length = 2;
+    double const dx = length / n;
+    return DDom<DDim<X>>(ddc::init_discrete_space<DDim<X>>(DDim<X>::template init<DDim<X>>(
+            ddc::Coordinate<X>(dx / 2),
+            ddc::Coordinate<X>(length - dx / 2),
+            DVect<DDim<X>>(n))));
+}
+
+/**
+ * The m-th DCT-II (resp. DST-II) mode cos(k_m*x) (resp. sin(k_m*x)) is transformed by FFTW into
+ * N times the m-th unit vector.
+ */
+template <typename T, bool IsCosine>
+void test_r2r_mode()
+{
+    using DDimX = DDim<RDimX>;
+    using DDimKx = std::conditional_t<
+            IsCosine,
+            DKDim<ddc::Cosine<RDimX>>,
+            DKDim<ddc::Sine<RDimX>>>;
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    std::size_t const n = 16;
+    DElem<DDimKx> const mode(5);
+
+    DDom<DDimX> const x_mesh = init_cell_centered_mesh<RDimX>(n);
+    if constexpr (IsCosine) {
+        ddc::init_discrete_space<DDimKx>(ddc::init_cosine_space<DDimKx>(x_mesh));
+    } else {
+        ddc::init_discrete_space<DDimKx>(ddc::init_sine_space<DDimKx>(x_mesh));
+    }
+    DDom<DDimKx> const k_mesh = ddc::r2r_mesh<DDimKx>(x_mesh);
+    EXPECT_EQ(k_mesh.size(), n);
+
+    ddc::Chunk f_alloc(x_mesh, ddc::HostAllocator<T>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    double const k = ddc::coordinate(mode);
+    ddc::for_each(x_mesh, [&](DElem<DDimX> const ix) {
+        double const x = ddc::coordinate(ix);
+        f(ix) = IsCosine ? Kokkos::cos(k * x) : Kokkos::sin(k * x);
+    });
+
+    ddc::Chunk Ff_alloc(k_mesh, ddc::HostAllocator<T>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::Chunk FFf_alloc(x_mesh, ddc::HostAllocator<T>());
+    ddc::ChunkSpan const FFf = FFf_alloc.span_view();
+    if constexpr (IsCosine) {
+        ddc::dct(exec_space, Ff, f.span_cview());
+        ddc::idct(exec_space, FFf, Ff.span_cview(), {ddc::FFT_Normalization::BACKWARD});
+    } else {
+        ddc::dst(exec_space, Ff, f.span_cview());
+        ddc::idst(exec_space, FFf, Ff.span_cview(), {ddc::FFT_Normalization::BACKWARD});
+    }
+    exec_space.fence();
+
+    double const epsilon = std::is_same_v<T, double> ? 1e-12 : 1e-4;
+    ddc::for_each(k_mesh, [&](DElem<DDimKx> const ik) {
+        EXPECT_NEAR(Ff(ik), ik == mode ? n : 0, epsilon * n);
+    });
+    ddc::for_each(x_mesh, [&](DElem<DDimX> const ix) { EXPECT_NEAR(FFf(ix), f(ix), epsilon); });
+}
+
+} // namespace anonymous_namespace_workaround_r2r_cpp
+
+TEST(R2r, DctMode)
+{
+    test_r2r_mode<double, true>();
+}
+
+TEST(R2r, DstMode)
+{
+    test_r2r_mode<double, false>();
+}
+
+TEST(R2r, DctModeFloat)
+{
+    test_r2r_mode<float, true>();
+}
+
+TEST(R2r, CosineSpace)
+{
+    using DDimX = DDim<RDimX>;
+    using DDimCx = DKDim<ddc::Cosine<RDimX>>;
+    using DDimSx = DKDim<ddc::Sine<RDimX>>;
+    DDom<DDimX> const x_mesh = init_cell_centered_mesh<RDimX>(8);
+    ddc::init_discrete_space<DDimCx>(ddc::init_cosine_space<DDimCx>(x_mesh));
+    ddc::init_discrete_space<DDimSx>(ddc::init_sine_space<DDimSx>(x_mesh));
+    DDom<DDimCx> const c_mesh = ddc::r2r_mesh<DDimCx>(x_mesh);
+    DDom<DDimSx> const s_mesh = ddc::r2r_mesh<DDimSx>(x_mesh);
+    // k_m = m*pi/L for the DCT and (m+1)*pi/L for the DST, with L = 2
+    EXPECT_DOUBLE_EQ(ddc::coordinate(c_mesh.front()), 0);
+    EXPECT_DOUBLE_EQ(ddc::step<DDimCx>(), Kokkos::numbers::pi / 2);
+    EXPECT_DOUBLE_EQ(ddc::coordinate(s_mesh.front()), Kokkos::numbers::pi / 2);
+    EXPECT_DOUBLE_EQ(ddc::coordinate(s_mesh.back()), 8 * Kokkos::numbers::pi / 2);
+}
+
+TEST(R2r, Batched)
+{
+    using DDimX = DDim<RDimX>;
+    using DDimKx = DKDim<ddc::Cosine<RDimX>>;
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    std::size_t const n = 12;
+
+    DDom<DDimX> const x_mesh = init_cell_centered_mesh<RDimX>(n);
+    ddc::init_discrete_space<DDimKx>(ddc::init_cosine_space<DDimKx>(x_mesh));
+    DDom<DDimBatch> const batch_mesh(DElem<DDimBatch>(0), DVect<DDimBatch>(3));
+    DDom<DDimX, DDimBatch> const xb_mesh(x_mesh, batch_mesh);
+    DDom<DDimKx, DDimBatch> const kb_mesh = ddc::r2r_mesh<DDimKx, DDimBatch>(xb_mesh);
+
+    ddc::Chunk f_alloc(xb_mesh, ddc::HostAllocator<double>());
+    ddc::ChunkSpan const f = f_alloc.span_view();
+    ddc::for_each(xb_mesh, [&](DElem<DDimX, DDimBatch> const e) {
+        double const x = ddc::coordinate(DElem<DDimX>(e));
+        f(e) = (DElem<DDimBatch>(e).uid() + 1) * Kokkos::exp(-x * x);
+    });
+
+    ddc::Chunk Ff_alloc(kb_mesh, ddc::HostAllocator<double>());
+    ddc::ChunkSpan const Ff = Ff_alloc.span_view();
+    ddc::dct(exec_space, Ff, f.span_cview(), {ddc::FFT_Normalization::FORWARD});
+    exec_space.fence();
+
+    // Each batch is transformed independently
+    ddc::for_each(kb_mesh, [&](DElem<DDimKx, DDimBatch> const e) {
+        DElem<DDimKx, DDimBatch> const e0(DElem<DDimKx>(e), batch_mesh.front());
+        EXPECT_NEAR(Ff(e), (DElem<DDimBatch>(e).uid() + 1) * Ff(e0), 1e-14);
+    });
+
+    ddc::Chunk FFf_alloc(xb_mesh, ddc::HostAllocator<double>());
+    ddc::ChunkSpan const FFf = FFf_alloc.span_view();
+    ddc::idct(exec_space, FFf, Ff.span_cview(), {ddc::FFT_Normalization::FORWARD});
+    exec_space.fence();
+    ddc::for_each(xb_mesh, [&](DElem<DDimX, DDimBatch> const e) {
+        EXPECT_NEAR(FFf(e), f(e), 1e-12);
+    });
+}
+
+TEST(R2r, UnsupportedNormalization)
+{
+    using DDimX = DDim<RDimX>;
+    using DDimKx = DKDim<ddc::Cosine<RDimX>>;
+    DDom<DDimX> const x_mesh = init_cell_centered_mesh<RDimX>(4);
+    ddc::init_discrete_space<DDimKx>(ddc::init_cosine_space<DDimKx>(x_mesh));
+    ddc::Chunk f_alloc(x_mesh, ddc::HostAllocator<double>());
+    ddc::Chunk Ff_alloc(ddc::r2r_mesh<DDimKx>(x_mesh), ddc::HostAllocator<double>());
+    EXPECT_THROW(
+            ddc::dct(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    Ff_alloc.span_view(),
+                    f_alloc.span_view(),
+                    {ddc::FFT_Normalization::ORTHO}),
+            std::runtime_error);
+}
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_instrumentation_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+std::vector<std::string> g_regions;
+
+std::vector<std::string> g_events;
+
+// Only the regions and events of DDC are recorded, Kokkos may emit its own ones
+void record_region(char const* const name)
+{
+    std::string const region(name);
+    if (region.rfind("ddc_", 0) == 0) {
+        g_regions.push_back(region);
+    }
+}
+
+void record_event(char const* const name)
+{
+    std::string const event(name);
+    if (event.rfind(ddc::detail::s_work_event_prefix, 0) == 0) {
+        g_events.push_back(event);
+    }
+}
+
+} // namespace anonymous_namespace_workaround_instrumentation_cpp
+
+TEST(Instrumentation, WorkEvent)
+{
+    ddc::detail::WorkInfo const info {10, 8, 80, 160};
+    EXPECT_EQ(
+            ddc::detail::work_event(info),
+            "ddc_work elements=10 element_size=8 bytes_read=80 bytes_written=160");
+}
+
+TEST(Instrumentation, AlgorithmsWithoutTool)
+{
+    // The regions and events are no-ops when no Kokkos Tools library is loaded
+    DDomX const dom(DElemX(0), DVectX(10));
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk_span, 1.);
+    EXPECT_EQ(
+            ddc::parallel_transform_reduce(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    dom,
+                    0.,
+                    ddc::reducer::sum<double>(),
+                    [=](DElemX const ix) { return chunk_span(ix); }),
+            10.);
+}
+
+TEST(Instrumentation, AlgorithmsWithTool)
+{
+    g_regions.clear();
+    g_events.clear();
+    Kokkos::Tools::Experimental::set_push_region_callback(record_region);
+    Kokkos::Tools::Experimental::set_profile_event_callback(record_event);
+
+    DDomX const dom(DElemX(0), DVectX(10));
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk_span, 1.);
+    double const sum = ddc::parallel_transform_reduce(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            0.,
+            ddc::reducer::sum<double>(),
+            [=](DElemX const ix) { return chunk_span(ix); });
+
+    Kokkos::Tools::Experimental::set_push_region_callback(nullptr);
+    Kokkos::Tools::Experimental::set_profile_event_callback(nullptr);
+
+    EXPECT_EQ(sum, 10.);
+    EXPECT_EQ(
+            g_regions,
+            (std::vector<std::string> {
+                    "ddc_parallel_fill",
+                    "ddc_parallel_transform_reduce_default"}));
+    EXPECT_EQ(
+            g_events,
+            (std::vector<std::string> {
+                    "ddc_work elements=10 element_size=8 bytes_read=0 bytes_written=80",
+                    "ddc_work elements=10 element_size=8 bytes_read=0 bytes_written=0"}));
+}
@@ -0,0 +1,119 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/io.hpp>
+#include <ddc/mapped_chunk.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_io_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+struct DDimZ
+{
+};
+using DDomZY = ddc::DiscreteDomain<DDimZ, DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemXY const lbound_x_y(DElemX(3), DElemY(5));
+DVectXY const nelems_x_y(DVectX(10), DVectY(12));
+
+std::string temporary_path(std::string const& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+double value(DElemXY const ixy)
+{
+    return 100. * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid();
+}
+
+} // namespace anonymous_namespace_workaround_io_cpp
+
+TEST(Io, WriteAndRead)
+{
+    std::string const path = temporary_path("ddc_io_write_and_read.bin");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::for_each(dom, [&](DElemXY const ixy) { chunk(ixy) = value(ixy); });
+    ddc::io::write_chunk(path, chunk.span_cview());
+
+    EXPECT_EQ(ddc::io::read_domain<DDomXY>(path), dom);
+    ddc::Chunk read(ddc::io::read_domain<DDomXY>(path), ddc::HostAllocator<double>());
+    ddc::io::read_chunk(path, read.span_view());
+    ddc::for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(read(ixy), value(ixy)); });
+
+    auto const mapped = ddc::io::map_chunk<double const, DDomXY>(path);
+    EXPECT_EQ(mapped.domain(), dom);
+    ddc::for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(mapped.span_cview()(ixy), value(ixy)); });
+
+    auto const opened = ddc::MappedChunk<double const, DDomXY>::open(path);
+    EXPECT_EQ(opened.span_cview()(lbound_x_y), value(lbound_x_y));
+    std::filesystem::remove(path);
+}
+
+TEST(Io, SeveralBlocks)
+{
+    std::string const path = temporary_path("ddc_io_several_blocks.bin");
+    // Larger than two I/O blocks
+    DDomX const dom(DElemX(0), DVectX(2 * ddc::io::detail::s_io_block_size / sizeof(int) + 7));
+    ddc::Chunk chunk(dom, ddc::HostAllocator<int>());
+    ddc::parallel_for_each(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            [=, span = chunk.span_view()](DElemX const ix) { span(ix) = int(ix.uid()); });
+    ddc::io::write_chunk(path, chunk.span_cview());
+
+    ddc::Chunk read(dom, ddc::HostAllocator<int>());
+    ddc::io::read_chunk(path, read.span_view());
+    ddc::ChunkSpan const read_span = read.span_cview();
+    int const nb_errors = ddc::parallel_transform_reduce(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            0,
+            ddc::reducer::sum<int>(),
+            [=](DElemX const ix) { return read_span(ix) == int(ix.uid()) ? 0 : 1; });
+    EXPECT_EQ(nb_errors, 0);
+    std::filesystem::remove(path);
+}
+
+TEST(Io, Mismatch)
+{
+    std::string const path = temporary_path("ddc_io_mismatch.bin");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk(dom, ddc::HostAllocator<double>());
+    ddc::parallel_fill(chunk, 1.);
+    ddc::io::write_chunk(path, chunk.span_cview());
+
+    ddc::Chunk other(DDomXY(lbound_x_y, DVectXY(2, 2)), ddc::HostAllocator<double>());
+    EXPECT_THROW(ddc::io::read_chunk(path, other.span_view()), std::runtime_error);
+    EXPECT_THROW((ddc::io::map_chunk<double const, DDomZY>(path)), std::runtime_error);
+    EXPECT_THROW((ddc::io::map_chunk<long const, DDomXY>(path)), std::runtime_error);
+    EXPECT_THROW((ddc::io::map_chunk<double const, DDomX>(path)), std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW(ddc::io::read_domain<DDomXY>(path), std::runtime_error);
+}
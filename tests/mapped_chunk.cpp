@@ -0,0 +1,126 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/mapped_chunk.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_mapped_chunk_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemXY const lbound_x_y(DElemX(3), DElemY(5));
+DVectXY const nelems_x_y(DVectX(10), DVectY(12));
+
+std::string temporary_path(std::string const& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace anonymous_namespace_workaround_mapped_chunk_cpp
+
+TEST(MappedChunk, CreateAndReopen)
+{
+    std::string const path = temporary_path("ddc_mapped_chunk_create_and_reopen.bin");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    {
+        auto const chunk = ddc::MappedChunk<double, DDomXY>::create(
+                path,
+                dom,
+                ddc::MappedChunkAdvice::SEQUENTIAL);
+        EXPECT_EQ(chunk.domain(), dom);
+        ddc::ChunkSpan const span = chunk.span_view();
+        ddc::for_each(dom, [&](DElemXY const ixy) {
+            span(ixy) = 100. * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid();
+        });
+        chunk.flush();
+    }
+    {
+        auto const chunk = ddc::MappedChunk<double const, DDomXY>::open(path);
+        EXPECT_EQ(chunk.domain(), dom);
+        ddc::ChunkSpan const span = chunk.span_cview();
+        ddc::for_each(dom, [&](DElemXY const ixy) {
+            EXPECT_EQ(
+                    span(ixy),
+                    100. * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid());
+        });
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MappedChunk, ParallelTransformReduce)
+{
+    std::string const path = temporary_path("ddc_mapped_chunk_transform_reduce.bin");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    {
+        auto const chunk = ddc::MappedChunk<int, DDomXY>::create(path, dom);
+        ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk.span_view(), 1);
+    }
+    auto const chunk = ddc::MappedChunk<int const, DDomXY>::open(
+            path,
+            ddc::MappedChunkAdvice::SEQUENTIAL);
+    ddc::ChunkSpan const span = chunk.span_cview();
+    int const sum = ddc::parallel_transform_reduce(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            0,
+            ddc::reducer::sum<int>(),
+            [=](DElemXY const ixy) { return span(ixy); });
+    EXPECT_EQ(sum, dom.size());
+    std::filesystem::remove(path);
+}
+
+TEST(MappedChunk, ReadWrite)
+{
+    std::string const path = temporary_path("ddc_mapped_chunk_read_write.bin");
+    DDomX const dom(DElemX(0), DVectX(10));
+    {
+        auto const chunk = ddc::MappedChunk<int, DDomX>::create(path, dom);
+        ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), chunk.span_view(), 1);
+    }
+    {
+        auto const chunk = ddc::MappedChunk<int, DDomX>::open(path, ddc::MappedChunkAdvice::RANDOM);
+        chunk.span_view()(DElemX(4)) = 2;
+    }
+    auto const chunk = ddc::MappedChunk<int const, DDomX>::open(path);
+    EXPECT_EQ(chunk.span_cview()(DElemX(3)), 1);
+    EXPECT_EQ(chunk.span_cview()(DElemX(4)), 2);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedChunk, Mismatch)
+{
+    std::string const path = temporary_path("ddc_mapped_chunk_mismatch.bin");
+    DDomX const dom(DElemX(0), DVectX(10));
+    {
+        auto const chunk = ddc::MappedChunk<int, DDomX>::create(path, dom);
+    }
+    EXPECT_THROW((ddc::MappedChunk<int const, DDomXY>::open(path)), std::runtime_error);
+    EXPECT_THROW((ddc::MappedChunk<double const, DDomX>::open(path)), std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW((ddc::MappedChunk<int const, DDomX>::open(path)), std::runtime_error);
+}
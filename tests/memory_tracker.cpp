@@ -0,0 +1,82 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <sstream>
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_memory_tracker_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+DDomX const dom_x(DElemX(0), DVectX(10));
+
+} // namespace anonymous_namespace_workaround_memory_tracker_cpp
+
+TEST(MemoryTracker, PerLabel)
+{
+    ddc::reset_memory_usage_peaks();
+    ddc::MemoryUsage const initial_usage = ddc::memory_usage();
+    {
+        ddc::Chunk const chunk_a("memory_tracker_a", dom_x, ddc::HostAllocator<double>());
+        ddc::MemoryUsage const usage_a = ddc::memory_usage_per_label().at("memory_tracker_a");
+        EXPECT_EQ(usage_a.current_bytes, 10 * sizeof(double));
+        EXPECT_EQ(usage_a.peak_bytes, 10 * sizeof(double));
+        EXPECT_EQ(usage_a.allocation_count, 1U);
+        {
+            ddc::Chunk const chunk_b("memory_tracker_b", dom_x, ddc::HostAllocator<int>());
+            EXPECT_EQ(
+                    ddc::memory_usage().current_bytes,
+                    initial_usage.current_bytes + 10 * (sizeof(double) + sizeof(int)));
+        }
+        ddc::MemoryUsage const usage_b = ddc::memory_usage_per_label().at("memory_tracker_b");
+        EXPECT_EQ(usage_b.current_bytes, 0U);
+        EXPECT_EQ(usage_b.peak_bytes, 10 * sizeof(int));
+        EXPECT_EQ(usage_b.allocation_count, 1U);
+    }
+    ddc::MemoryUsage const final_usage = ddc::memory_usage();
+    EXPECT_EQ(final_usage.current_bytes, initial_usage.current_bytes);
+    EXPECT_EQ(
+            final_usage.peak_bytes,
+            initial_usage.current_bytes + 10 * (sizeof(double) + sizeof(int)));
+    EXPECT_EQ(final_usage.allocation_count, 2U);
+}
+
+TEST(MemoryTracker, PerMemorySpace)
+{
+    ddc::Chunk const chunk("memory_tracker", dom_x, ddc::HostAllocator<double>());
+    ddc::MemoryUsage const usage
+            = ddc::memory_usage_per_memory_space().at(Kokkos::HostSpace::name());
+    EXPECT_GE(usage.current_bytes, 10 * sizeof(double));
+}
+
+TEST(MemoryTracker, ResetPeaks)
+{
+    {
+        ddc::Chunk const chunk("memory_tracker_reset", dom_x, ddc::HostAllocator<double>());
+    }
+    ddc::reset_memory_usage_peaks();
+    ddc::MemoryUsage const usage = ddc::memory_usage_per_label().at("memory_tracker_reset");
+    EXPECT_EQ(usage.current_bytes, 0U);
+    EXPECT_EQ(usage.peak_bytes, 0U);
+    EXPECT_EQ(usage.allocation_count, 0U);
+}
+
+TEST(MemoryTracker, Print)
+{
+    ddc::Chunk const chunk("memory_tracker_print", dom_x, ddc::HostAllocator<double>());
+    std::stringstream ss;
+    ddc::print_memory_usage(ss);
+    EXPECT_NE(ss.str().find("memory_tracker_print"), std::string::npos);
+}
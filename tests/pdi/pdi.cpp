@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <cstddef>
+#include <stdexcept>
 #include <string>
 
 #include <ddc/ddc.hpp>
@@ -10,6 +11,8 @@
 
 #include <gtest/gtest.h>
 
+#include <Kokkos_Core.hpp>
+
 #include <paraconf.h>
 #include <pdi.h>
 
@@ -23,10 +26,88 @@ struct DDimY
 {
 };
 
+int nb_async_event_called = 0;
+
+int sum_async_values = 0;
+
+int nb_strided_event_called = 0;
+
 } // namespace
 
 extern "C" {
 
+/// Checks the elements exposed through the strides, the chunk storing 5 * x + y at (x, y)
+void test_ddc_expose_strided()
+{
+    void* pdi_chunk_label_rank_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label_rank", &pdi_chunk_label_rank_ptr, PDI_IN), PDI_OK);
+    std::size_t const rank = *static_cast<std::size_t*>(pdi_chunk_label_rank_ptr);
+
+    void* extents_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label_extents", &extents_ptr, PDI_IN), PDI_OK);
+    std::size_t const* const extents = static_cast<std::size_t*>(extents_ptr);
+
+    void* strides_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label_strides", &strides_ptr, PDI_IN), PDI_OK);
+    std::size_t const* const strides = static_cast<std::size_t*>(strides_ptr);
+
+    void* start_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label_start", &start_ptr, PDI_IN), PDI_OK);
+    std::size_t const* const start = static_cast<std::size_t*>(start_ptr);
+
+    void* pdi_chunk_label_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label", &pdi_chunk_label_ptr, PDI_IN), PDI_OK);
+    int const* const pdi_chunk_label = static_cast<int*>(pdi_chunk_label_ptr);
+
+    if (rank == 2) {
+        EXPECT_EQ(strides[0], 5);
+        EXPECT_EQ(strides[1], 1);
+        for (std::size_t i = 0; i < extents[0]; ++i) {
+            for (std::size_t j = 0; j < extents[1]; ++j) {
+                EXPECT_EQ(
+                        pdi_chunk_label[strides[0] * i + strides[1] * j],
+                        5 * (start[0] + i) + (start[1] + j));
+            }
+        }
+    } else {
+        // Slice along DDimX at y = 4
+        ASSERT_EQ(rank, 1);
+        EXPECT_EQ(strides[0], 5);
+        for (std::size_t i = 0; i < extents[0]; ++i) {
+            EXPECT_EQ(pdi_chunk_label[strides[0] * i], 5 * (start[0] + i) + 4);
+        }
+    }
+
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label_rank"), PDI_OK);
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label_extents"), PDI_OK);
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label_strides"), PDI_OK);
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label_start"), PDI_OK);
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label"), PDI_OK);
+    ++nb_strided_event_called;
+}
+
+void test_ddc_async_expose()
+{
+    void* pdi_chunk_label_extents_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label_extents", &pdi_chunk_label_extents_ptr, PDI_IN), PDI_OK);
+    std::size_t const* const pdi_chunk_label_extents
+            = static_cast<std::size_t*>(pdi_chunk_label_extents_ptr);
+    ASSERT_EQ(pdi_chunk_label_extents[0], 3);
+    ASSERT_EQ(pdi_chunk_label_extents[1], 5);
+
+    void* pdi_chunk_label_ptr;
+    ASSERT_EQ(PDI_access("pdi_chunk_label", &pdi_chunk_label_ptr, PDI_IN), PDI_OK);
+    int const* const pdi_chunk_label = static_cast<int*>(pdi_chunk_label_ptr);
+    for (std::size_t i = 0; i < pdi_chunk_label_extents[0] * pdi_chunk_label_extents[1]; ++i) {
+        EXPECT_EQ(pdi_chunk_label[i], pdi_chunk_label[0]);
+    }
+    sum_async_values += pdi_chunk_label[0];
+    ++nb_async_event_called;
+
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label_extents"), PDI_OK);
+    EXPECT_EQ(PDI_reclaim("pdi_chunk_label"), PDI_OK);
+}
+
 void test_ddc_expose()
 {
     // pdi_chunk_label_rank
@@ -127,3 +208,163 @@ plugins:
     PDI_finalize();
     PC_tree_destroy(&pdi_conf);
 }
+
+TEST(Pdi, PersistentEvent)
+{
+    std::string const pdi_cfg = R"PDI_CFG(
+metadata:
+  pdi_chunk_label_rank: size_t
+  pdi_chunk_label_extents:
+    type: array
+    subtype: size_t
+    size: $pdi_chunk_label_rank
+
+data:
+  pdi_chunk_label:
+    type: array
+    subtype: int
+    size: [ '$pdi_chunk_label_extents[0]', '$pdi_chunk_label_extents[1]' ]
+  nb_event_called: int
+
+plugins:
+  user_code:
+    on_event:
+      some_event:
+        test_ddc_expose: {}
+)PDI_CFG";
+
+    PC_tree_t pdi_conf = PC_parse_string(pdi_cfg.c_str());
+    PDI_init(pdi_conf);
+
+    PDI_errhandler(PDI_NULL_HANDLER);
+
+    {
+        ddc::DiscreteDomain<DDimX> const ddom_x
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimX>(3));
+        ddc::DiscreteDomain<DDimY> const ddom_y
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimY>(5));
+        ddc::DiscreteDomain<DDimX, DDimY> const ddom_xy(ddom_x, ddom_y);
+
+        ddc::Chunk chunk("ddc_chunk_label", ddom_xy, ddc::HostAllocator<int>());
+        ddc::parallel_fill(chunk, 3);
+
+        int nb_event_called = 0;
+
+        ddc::PersistentPdiEvent event("some_event");
+        std::size_t const chunk_slot = event.add_chunk("pdi_chunk_label", 2);
+        std::size_t const counter_slot = event.add_scalar<PDI_INOUT>("nb_event_called");
+
+        EXPECT_THROW(event.trigger(), std::runtime_error);
+        EXPECT_THROW(event.arm(chunk_slot, nb_event_called), std::runtime_error);
+
+        event.arm(chunk_slot, chunk).arm(counter_slot, nb_event_called).trigger();
+        event.arm(chunk_slot, chunk.span_view()).arm(counter_slot, nb_event_called).trigger();
+        event.arm(chunk_slot, chunk.span_cview()).arm(counter_slot, nb_event_called).trigger();
+
+        EXPECT_EQ(nb_event_called, 3);
+    }
+
+    PDI_finalize();
+    PC_tree_destroy(&pdi_conf);
+}
+
+TEST(Pdi, AsyncOutput)
+{
+    std::string const pdi_cfg = R"PDI_CFG(
+metadata:
+  pdi_chunk_label_rank: size_t
+  pdi_chunk_label_extents:
+    type: array
+    subtype: size_t
+    size: $pdi_chunk_label_rank
+
+data:
+  pdi_chunk_label:
+    type: array
+    subtype: int
+    size: [ '$pdi_chunk_label_extents[0]', '$pdi_chunk_label_extents[1]' ]
+
+plugins:
+  user_code:
+    on_event:
+      async_event:
+        test_ddc_async_expose: {}
+)PDI_CFG";
+
+    PC_tree_t pdi_conf = PC_parse_string(pdi_cfg.c_str());
+    PDI_init(pdi_conf);
+
+    PDI_errhandler(PDI_NULL_HANDLER);
+
+    {
+        ddc::DiscreteDomain<DDimX> const ddom_x
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimX>(3));
+        ddc::DiscreteDomain<DDimY> const ddom_y
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimY>(5));
+        ddc::DiscreteDomain<DDimX, DDimY> const ddom_xy(ddom_x, ddom_y);
+
+        Kokkos::DefaultExecutionSpace const exec_space;
+        ddc::Chunk chunk("ddc_chunk_label", ddom_xy, ddc::DeviceAllocator<int>());
+
+        ddc::AsyncPdiOutput<Kokkos::DefaultExecutionSpace, int, ddc::DiscreteDomain<DDimX, DDimY>>
+                output(exec_space, "async_event", "pdi_chunk_label", ddom_xy);
+        for (int step = 1; step <= 3; ++step) {
+            ddc::parallel_fill(exec_space, chunk, step);
+            output.write(chunk.span_cview());
+            output.fence_copy();
+        }
+        output.wait();
+
+        EXPECT_EQ(nb_async_event_called, 3);
+        EXPECT_EQ(sum_async_values, 1 + 2 + 3);
+    }
+
+    PDI_finalize();
+    PC_tree_destroy(&pdi_conf);
+}
+
+TEST(Pdi, StridedChunkSpan)
+{
+    std::string const pdi_cfg = R"PDI_CFG(
+plugins:
+  user_code:
+    on_event:
+      strided_event:
+        test_ddc_expose_strided: {}
+)PDI_CFG";
+
+    PC_tree_t pdi_conf = PC_parse_string(pdi_cfg.c_str());
+    PDI_init(pdi_conf);
+
+    PDI_errhandler(PDI_NULL_HANDLER);
+
+    {
+        ddc::DiscreteDomain<DDimX> const ddom_x
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimX>(3));
+        ddc::DiscreteDomain<DDimY> const ddom_y
+                = ddc::init_trivial_bounded_space(ddc::DiscreteVector<DDimY>(5));
+        ddc::DiscreteDomain<DDimX, DDimY> const ddom_xy(ddom_x, ddom_y);
+
+        ddc::Chunk chunk("ddc_chunk_label", ddom_xy, ddc::HostAllocator<int>());
+        ddc::for_each(ddom_xy, [&](ddc::DiscreteElement<DDimX, DDimY> const ixy) {
+            chunk(ixy) = int(5 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy));
+        });
+
+        ddc::DiscreteDomain<DDimX, DDimY> const subdomain(
+                ddc::DiscreteElement<DDimX, DDimY>(1, 2),
+                ddc::DiscreteVector<DDimX, DDimY>(2, 3));
+
+        ddc::PdiEvent("strided_event").with("pdi_chunk_label", chunk.span_cview()[subdomain]);
+        ddc::PdiEvent("strided_event")
+                .with("pdi_chunk_label", chunk.span_cview()[ddc::DiscreteElement<DDimY>(4)]);
+
+        ddc::PersistentPdiEvent event("strided_event");
+        std::size_t const slot = event.add_chunk("pdi_chunk_label", 2);
+        event.arm(slot, chunk.span_cview()[subdomain]).trigger();
+
+        EXPECT_EQ(nb_strided_event_called, 3);
+    }
+
+    PDI_finalize();
+    PC_tree_destroy(&pdi_conf);
+}
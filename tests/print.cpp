@@ -198,6 +198,46 @@ TEST(Print, CheckOutput2dElision)
     TestPrintCheckoutOutput2dElision<double>();
 }
 
+void PrintTestCheckOutput2dElisionSubdomain()
+{
+    ddc::DiscreteDomain<Dim4> const domain_4
+            = ddc::init_trivial_bounded_space(ddc::DiscreteVector<Dim4>(30));
+    ddc::DiscreteDomain<Dim5> const domain_5
+            = ddc::init_trivial_bounded_space(ddc::DiscreteVector<Dim5>(20));
+    ddc::DiscreteDomain<Dim4, Dim5> const domain_2d(domain_4, domain_5);
+
+    ddc::Chunk chunk("chunk", domain_2d, ddc::DeviceAllocator<int>());
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::parallel_for_each(
+            domain_2d,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<Dim4, Dim5> const i) {
+                chunk_span(i) = int(100 * ddc::uid<Dim4>(i) + ddc::uid<Dim5>(i));
+            });
+
+    // Only the edge items of the strided subdomain are gathered and copied to the host
+    ddc::DiscreteDomain<Dim4, Dim5> const subdomain(
+            ddc::DiscreteElement<Dim4, Dim5>(5, 2),
+            ddc::DiscreteVector<Dim4, Dim5>(12, 11));
+    {
+        std::stringstream ss;
+        print_content(ss, chunk_span[subdomain]);
+        EXPECT_EQ(
+                ss.str(),
+                "[[ 502  503  504 ...  510  511  512]\n"
+                " [ 602  603  604 ...  610  611  612]\n"
+                " [ 702  703  704 ...  710  711  712]\n"
+                " ...\n"
+                " [1402 1403 1404 ... 1410 1411 1412]\n"
+                " [1502 1503 1504 ... 1510 1511 1512]\n"
+                " [1602 1603 1604 ... 1610 1611 1612]]");
+    }
+}
+
+TEST(Print, CheckOutput2dElisionSubdomain)
+{
+    PrintTestCheckOutput2dElisionSubdomain();
+}
+
 template <typename ElementType>
 void PrintTestCheckoutOutput3d()
 {
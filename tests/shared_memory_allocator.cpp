@@ -0,0 +1,121 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+#include <ddc/shared_memory_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+inline namespace anonymous_namespace_workaround_shared_memory_allocator_cpp {
+
+struct DDimX
+{
+};
+using DElemX = ddc::DiscreteElement<DDimX>;
+using DVectX = ddc::DiscreteVector<DDimX>;
+using DDomX = ddc::DiscreteDomain<DDimX>;
+
+struct DDimY
+{
+};
+using DElemY = ddc::DiscreteElement<DDimY>;
+using DVectY = ddc::DiscreteVector<DDimY>;
+using DDomY = ddc::DiscreteDomain<DDimY>;
+
+using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+DElemXY const lbound_x_y(DElemX(0), DElemY(0));
+DVectXY const nelems_x_y(DVectX(10), DVectY(12));
+
+std::string segment_name(std::string const& name)
+{
+    return "/ddc_" + name + "_" + std::to_string(::getpid());
+}
+
+/// Run `f` in a child process and return its exit status
+template <class F>
+int run_in_child_process(F const& f)
+{
+    pid_t const pid = ::fork();
+    if (pid == 0) {
+        int status = 1;
+        try {
+            status = f();
+        } catch (...) {
+        }
+        ::_exit(status);
+    }
+    int status = -1;
+    ::waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+} // namespace anonymous_namespace_workaround_shared_memory_allocator_cpp
+
+TEST(SharedMemoryAllocator, ProducerConsumer)
+{
+    std::string const name = segment_name("producer_consumer");
+    DDomXY const dom(lbound_x_y, nelems_x_y);
+    ddc::Chunk chunk("chunk", dom, ddc::SharedMemoryAllocator<int>(name));
+    ddc::ChunkSpan const chunk_span = chunk.span_view();
+    ddc::for_each(dom, [&](DElemXY const ixy) {
+        chunk_span(ixy) = 100 * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid();
+    });
+
+    // The consumer reads the data of the producer and modifies it in place
+    int const status = run_in_child_process([&]() {
+        auto const shared = ddc::SharedMemoryChunk<int, DDomXY>::open(name, dom);
+        ddc::ChunkSpan const span = shared.span_view();
+        int errors = 0;
+        ddc::for_each(dom, [&](DElemXY const ixy) {
+            if (span(ixy)
+                != 100 * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid()) {
+                ++errors;
+            }
+            span(ixy) = -span(ixy);
+        });
+        return errors == 0 ? 0 : 1;
+    });
+    EXPECT_EQ(status, 0);
+
+    ddc::for_each(dom, [&](DElemXY const ixy) {
+        EXPECT_EQ(
+                chunk_span(ixy),
+                -(100 * ddc::select<DDimX>(ixy).uid() + ddc::select<DDimY>(ixy).uid()));
+    });
+}
+
+TEST(SharedMemoryAllocator, Unlink)
+{
+    std::string const name = segment_name("unlink");
+    DDomX const dom(DElemX(0), DVectX(10));
+    {
+        ddc::Chunk const chunk(dom, ddc::SharedMemoryAllocator<double>(name));
+        auto const shared = ddc::SharedMemoryChunk<double const, DDomX>::open(name, dom);
+        EXPECT_EQ(shared.domain(), dom);
+        EXPECT_THROW(
+                (ddc::Chunk<double, DDomX, ddc::SharedMemoryAllocator<double>>(
+                        dom,
+                        ddc::SharedMemoryAllocator<double>(name))),
+                std::runtime_error);
+    }
+    EXPECT_THROW((ddc::SharedMemoryChunk<double const, DDomX>::open(name, dom)), std::runtime_error);
+}
+
+TEST(SharedMemoryAllocator, TooSmall)
+{
+    std::string const name = segment_name("too_small");
+    ddc::Chunk const chunk(DDomX(DElemX(0), DVectX(10)), ddc::SharedMemoryAllocator<int>(name));
+    EXPECT_THROW(
+            (ddc::SharedMemoryChunk<int const, DDomX>::open(name, DDomX(DElemX(0), DVectX(20)))),
+            std::runtime_error);
+}
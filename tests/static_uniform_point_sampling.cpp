@@ -0,0 +1,65 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <ratio>
+#include <sstream>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+inline namespace anonymous_namespace_workaround_static_uniform_point_sampling_cpp {
+
+struct DimX;
+struct DimY;
+
+struct DDimX : ddc::StaticUniformPointSampling<DimX, std::ratio<-1>, std::ratio<1, 2>>
+{
+};
+
+struct DDimY : ddc::UniformPointSampling<DimY>
+{
+};
+
+ddc::DiscreteElement<DDimX> constexpr point_ix(2);
+ddc::Coordinate<DimX> constexpr point_rx(0.);
+
+} // namespace anonymous_namespace_workaround_static_uniform_point_sampling_cpp
+
+TEST(StaticUniformPointSampling, CompileTimeConstants)
+{
+    static_assert(ddc::step<DDimX>() == 0.5);
+    static_assert(ddc::origin<DDimX>() == ddc::Coordinate<DimX>(-1.));
+    static_assert(ddc::coordinate(point_ix) == point_rx);
+    static_assert(ddc::distance_at_left(point_ix) == ddc::Coordinate<DimX>(0.5));
+    static_assert(ddc::distance_at_right(point_ix) == ddc::Coordinate<DimX>(0.5));
+    static_assert(!ddc::is_uniform_point_sampling_v<DDimX>);
+    EXPECT_TRUE(ddc::is_static_uniform_point_sampling_v<DDimX>);
+}
+
+TEST(StaticUniformPointSampling, Formatting)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x;
+    std::stringstream oss;
+    oss << ddim_x;
+    EXPECT_EQ(oss.str(), "StaticUniformPointSampling( origin=(-1), step=0.5 )");
+}
+
+TEST(StaticUniformPointSampling, CoordinateWithUniform)
+{
+    ddc::DiscreteDomain<DDimX> const ddom_x
+            = ddc::init_discrete_space<DDimX>(DDimX::init<DDimX>(ddc::DiscreteVector<DDimX>(5)));
+    ddc::init_discrete_space<DDimY>(ddc::Coordinate<DimY>(-10.), 1.);
+    ddc::DiscreteElement<DDimY> const point_iy(4);
+    ddc::Coordinate<DimY> const point_ry(-6);
+
+    ddc::DiscreteElement<DDimX, DDimY> const point_ixy(point_ix, point_iy);
+    ddc::Coordinate<DimX, DimY> const point_rxy(point_rx, point_ry);
+    EXPECT_EQ(ddc::coordinate(point_ixy), point_rxy);
+    EXPECT_EQ(ddc::rmin(ddom_x), ddc::Coordinate<DimX>(-1.));
+    EXPECT_EQ(ddc::rmax(ddom_x), ddc::Coordinate<DimX>(1.));
+    EXPECT_EQ(ddc::discrete_space<DDimX>().coordinate(point_ix), point_rx);
+}
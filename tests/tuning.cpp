@@ -0,0 +1,76 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+TEST(Tuning, DefaultIsACandidate)
+{
+    ddc::TunableParameter const parameter("ddc_test_tuning_default", {1, 2}, 3);
+    EXPECT_EQ(parameter.candidates().size(), 3U);
+    EXPECT_EQ(parameter.candidates().back(), 3);
+}
+
+TEST(Tuning, AutotuneStoresTheFastestCandidate)
+{
+    ddc::TunableParameter const parameter("ddc_test_tuning_autotune", {1, 2, 4}, 1);
+    EXPECT_EQ(ddc::tuned_value(parameter, "shape"), std::nullopt);
+    {
+        ddc::TuningContext const context(parameter, "shape");
+        if (!Kokkos::Tools::Experimental::have_tuning_tool()) {
+            EXPECT_EQ(context.value(), 1);
+        }
+    }
+    std::int64_t const best = ddc::autotune(
+            Kokkos::DefaultHostExecutionSpace(),
+            parameter,
+            "shape",
+            [](std::int64_t const value) {
+                if (value != 2) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            });
+    EXPECT_EQ(best, 2);
+    EXPECT_EQ(ddc::tuned_value(parameter, "shape"), 2);
+    EXPECT_EQ(ddc::tuned_value(parameter, "other_shape"), std::nullopt);
+    ddc::TuningContext const context(parameter, "shape");
+    EXPECT_EQ(context.value(), 2);
+}
+
+TEST(Tuning, AutotuneSkipsFailingCandidates)
+{
+    ddc::TunableParameter const parameter("ddc_test_tuning_failure", {1, 2, 4}, 1);
+    std::int64_t const best = ddc::autotune(
+            Kokkos::DefaultHostExecutionSpace(),
+            parameter,
+            "shape",
+            [](std::int64_t const value) {
+                if (value == 2) {
+                    throw std::runtime_error("The candidate 2 does not converge");
+                }
+                if (value == 1) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            });
+    EXPECT_EQ(best, 4);
+    EXPECT_EQ(ddc::tuned_value(parameter, "shape"), 4);
+
+    EXPECT_THROW(
+            ddc::autotune(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    parameter,
+                    "other_shape",
+                    [](std::int64_t) { throw std::runtime_error("No candidate converges"); }),
+            std::runtime_error);
+    EXPECT_EQ(ddc::tuned_value(parameter, "other_shape"), std::nullopt);
+}
@@ -0,0 +1,191 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+/**
+ * Kokkos Tools connector aggregating the bandwidth of the DDC algorithms.
+ *
+ * DDC wraps its algorithms in a region named after their label and marks an event
+ * "ddc_work elements=... element_size=... bytes_read=... bytes_written=..." at the beginning
+ * of the region. This connector sums, per label, the number of calls, the time spent in the
+ * region and the work described by the events, then prints a table at exit:
+ *
+ *     DDC_INSTRUMENTATION_FENCE=1 KOKKOS_TOOLS_LIBS=libddc_kokkos_tools_bandwidth.so ./application
+ *
+ * DDC_INSTRUMENTATION_FENCE makes DDC fence the execution space at the end of its regions, without
+ * it the time of the asynchronous kernels is not accounted for.
+ *
+ * The bytes accessed by an algorithm taking a user functor, e.g. `parallel_for_each`, are unknown
+ * and reported as 0, the data and the bandwidth of such labels are printed as "-".
+ *
+ * Only the outermost instrumented region is accounted for, the algorithms called by another one
+ * (e.g. the `parallel_for_each` of a spline evaluation) are attributed to the caller.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char const* s_work_event_prefix = "ddc_work";
+
+struct LabelStats
+{
+    std::uint64_t calls = 0;
+
+    double seconds = 0;
+
+    std::uint64_t elements = 0;
+
+    std::uint64_t bytes_read = 0;
+
+    std::uint64_t bytes_written = 0;
+};
+
+struct Region
+{
+    std::string name;
+
+    std::chrono::steady_clock::time_point start;
+
+    bool has_work;
+
+    LabelStats work;
+};
+
+std::mutex g_mutex;
+
+std::vector<Region> g_regions;
+
+std::map<std::string, LabelStats> g_stats;
+
+bool parse_work_event(char const* const name, LabelStats& work)
+{
+    std::size_t const prefix_size = std::strlen(s_work_event_prefix);
+    if (std::strncmp(name, s_work_event_prefix, prefix_size) != 0) {
+        return false;
+    }
+    std::istringstream is(name + prefix_size);
+    std::string token;
+    while (is >> token) {
+        std::size_t const eq = token.find('=');
+        if (eq == std::string::npos) {
+            continue;
+        }
+        std::string const key = token.substr(0, eq);
+        std::uint64_t const value = std::stoull(token.substr(eq + 1));
+        if (key == "elements") {
+            work.elements = value;
+        } else if (key == "bytes_read") {
+            work.bytes_read = value;
+        } else if (key == "bytes_written") {
+            work.bytes_written = value;
+        }
+    }
+    return true;
+}
+
+bool inside_work_region()
+{
+    for (Region const& region : g_regions) {
+        if (region.has_work) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+extern "C" {
+
+void kokkosp_init_library(
+        int const /* load_seq */,
+        std::uint64_t const /* interface_version */,
+        std::uint32_t const /* device_info_count */,
+        void* /* device_info */)
+{
+}
+
+void kokkosp_finalize_library()
+{
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    std::printf(
+            "\nDDC bandwidth\n%-40s %10s %12s %14s %12s %10s\n",
+            "label",
+            "calls",
+            "time (s)",
+            "elements",
+            "data (GB)",
+            "GB/s");
+    for (auto const& [label, stats] : g_stats) {
+        std::printf(
+                "%-40s %10llu %12.6f %14llu",
+                label.c_str(),
+                static_cast<unsigned long long>(stats.calls),
+                stats.seconds,
+                static_cast<unsigned long long>(stats.elements));
+        std::uint64_t const bytes = stats.bytes_read + stats.bytes_written;
+        if (bytes == 0) {
+            std::printf(" %12s %10s\n", "-", "-");
+            continue;
+        }
+        double const gigabytes = double(bytes) * 1e-9;
+        if (stats.seconds > 0) {
+            std::printf(" %12.6f %10.3f\n", gigabytes, gigabytes / stats.seconds);
+        } else {
+            std::printf(" %12.6f %10s\n", gigabytes, "-");
+        }
+    }
+    if (std::getenv("DDC_INSTRUMENTATION_FENCE") == nullptr) {
+        std::printf(
+                "Warning: DDC_INSTRUMENTATION_FENCE is not set, the time of the asynchronous "
+                "kernels may be missing\n");
+    }
+}
+
+void kokkosp_push_profile_region(char const* const name)
+{
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    g_regions.push_back({name, std::chrono::steady_clock::now(), false, {}});
+}
+
+void kokkosp_pop_profile_region()
+{
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    if (g_regions.empty()) {
+        return;
+    }
+    Region const region = g_regions.back();
+    g_regions.pop_back();
+    if (!region.has_work) {
+        return;
+    }
+    LabelStats& stats = g_stats[region.name];
+    ++stats.calls;
+    stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - region.start)
+                             .count();
+    stats.elements += region.work.elements;
+    stats.bytes_read += region.work.bytes_read;
+    stats.bytes_written += region.work.bytes_written;
+}
+
+void kokkosp_profile_event(char const* const name)
+{
+    std::lock_guard<std::mutex> const lock(g_mutex);
+    if (g_regions.empty() || inside_work_region()) {
+        return;
+    }
+    Region& region = g_regions.back();
+    region.has_work = parse_work_event(name, region.work);
+}
+
+} // extern "C"